@@ -67,6 +67,13 @@ cdef extern from "input_output/FGPropertyManager.h" namespace "JSBSim":
         c_FGPropertyManager()
         bool HasNode(string path) except +convertJSBSimToPyExc
 
+    cdef cppclass c_FGPropertyList "JSBSim::FGPropertyList":
+        c_FGPropertyList(c_FGPropertyManager* pm, const vector[string]& names,
+                         bool create) except +convertJSBSimToPyExc
+        size_t GetSize()
+        void GetValues(double* values)
+        void SetValues(const double* values)
+
 cdef extern from "math/FGColumnVector3.h" namespace "JSBSim":
     cdef cppclass c_FGColumnVector3 "JSBSim::FGColumnVector3":
         c_FGColumnVector3()
@@ -175,6 +182,10 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         c_FGFDMExec(c_FGPropertyManager* root, unsigned int* fdmctr)
         void Unbind() except +convertJSBSimToPyExc
         bool Run() except +convertJSBSimToPyExc
+        bool RunUntil(double sim_time,
+                      const string& condition) except +convertJSBSimToPyExc
+        bool RunFrames(unsigned int frames,
+                       const string& condition) except +convertJSBSimToPyExc
         bool RunIC() except +convertJSBSimToPyExc
         bool LoadModel(string model,
                        bool add_model_to_path) except +convertJSBSimToPyExc
@@ -183,6 +194,8 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
                        const c_SGPath systems_path,
                        const string model,
                        bool add_model_to_path) except +convertJSBSimToPyExc
+        bool WriteModelImage(const c_SGPath& filename)
+        c_FGFDMExec* Clone() except +convertJSBSimToPyExc
         bool LoadScript(const c_SGPath& script, double delta_t,
                         const c_SGPath& initfile) except +convertJSBSimToPyExc
         bool SetEnginePath(const c_SGPath& path)
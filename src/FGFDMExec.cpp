@@ -42,13 +42,16 @@ COMMENTS, REFERENCES,  and NOTES
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <chrono>
 #include <iomanip>
+#include <mutex>
 
 #include "FGFDMExec.h"
 #include "models/atmosphere/FGStandardAtmosphere.h"
 #include "models/atmosphere/FGWinds.h"
 #include "models/FGFCS.h"
 #include "models/FGPropulsion.h"
+#include "models/propulsion/FGThruster.h"
 #include "models/FGMassBalance.h"
 #include "models/FGExternalReactions.h"
 #include "models/FGBuoyantForces.h"
@@ -61,12 +64,103 @@ INCLUDES
 #include "initialization/FGTrim.h"
 #include "input_output/FGScript.h"
 #include "input_output/FGXMLFileRead.h"
+#include "input_output/FGModelLoader.h"
+#include "input_output/string_utilities.h"
+#include "math/FGCondition.h"
 #include "initialization/FGInitialCondition.h"
 
 using namespace std;
 
 namespace JSBSim {
 
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+GLOBAL DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Names used by the scheduler properties. The order must match eModels.
+static const char* const ModelNames[FGFDMExec::eNumStandardModels] = {
+  "propagate", "input", "inertial", "atmosphere", "winds", "systems",
+  "mass_balance", "auxiliary", "propulsion", "aerodynamics",
+  "ground_reactions", "external_reactions", "buoyant_forces", "aircraft",
+  "accelerations", "output" };
+
+// Copies the values of the readable and writable properties of the tree
+// "from" to the nodes of the same name in the tree "to". The nodes that do not
+// exist in "to" are ignored, so are the nodes tied to a variable unless "tied"
+// is true.
+static void CopyPropertyValues(SGPropertyNode* from, SGPropertyNode* to,
+                               bool tied)
+{
+  for (int i=0; i < from->nChildren(); i++) {
+    SGPropertyNode* source = from->getChild(i);
+    SGPropertyNode* target = to->getChild(source->getNameString(),
+                                          source->getIndex(), false);
+    if (!target) continue;
+
+    if (source->nChildren() > 0) {
+      CopyPropertyValues(source, target, tied);
+      continue;
+    }
+
+    if (source->isAlias() || (!tied && source->isTied())
+        || !source->getAttribute(SGPropertyNode::READ)
+        || !source->getAttribute(SGPropertyNode::WRITE)
+        || !target->getAttribute(SGPropertyNode::WRITE))
+      continue;
+
+    switch(source->getType()) {
+    case simgear::props::BOOL:
+      target->setBoolValue(source->getBoolValue());
+      break;
+    case simgear::props::INT:
+      target->setIntValue(source->getIntValue());
+      break;
+    case simgear::props::LONG:
+      target->setLongValue(source->getLongValue());
+      break;
+    case simgear::props::FLOAT:
+    case simgear::props::DOUBLE:
+      target->setDoubleValue(source->getDoubleValue());
+      break;
+    case simgear::props::STRING:
+    case simgear::props::UNSPECIFIED:
+      target->setStringValue(source->getStringValue());
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+// Silences the messages of the executives for the lifetime of the object, even
+// if an exception is thrown. The debug level is shared by all the executives:
+// the silencers are counted so that, when several executives are cloned
+// concurrently, the debug level is restored once all of them are done.
+class FGDebugSilencer : public FGJSBBase
+{
+public:
+  FGDebugSilencer(void) {
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Count++ == 0) {
+      SavedLevel = debug_lvl;
+      debug_lvl = 0;
+    }
+  }
+  ~FGDebugSilencer() {
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (--Count == 0) debug_lvl = SavedLevel;
+  }
+
+private:
+  static std::mutex Mutex;
+  static unsigned int Count;
+  static short SavedLevel;
+};
+
+std::mutex FGDebugSilencer::Mutex;
+unsigned int FGDebugSilencer::Count = 0;
+short FGDebugSilencer::SavedLevel = 0;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -126,6 +220,11 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   FGPropertyNode* instanceRoot = Root->GetNode("/fdm/jsbsim", IdFDM, true);
   instance = std::make_shared<FGPropertyManager>(instanceRoot);
 
+  Profiler = std::make_shared<FGProfiler>(instance, IdFDM);
+  for (unsigned int i = 0; i < eNumStandardModels; i++)
+    ModelSections.push_back(Profiler->Register(FGProfiler::eModel,
+                                               ModelNames[i]));
+
   try {
     char* num = getenv("JSBSIM_DISPERSE");
     if (num) {
@@ -168,6 +267,7 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   instance->Tie("simulation/frame", (int *)&Frame);
   instance->Tie("simulation/trim-completed", (int *)&trim_completed);
   instance->Tie("forces/hold-down", this, &FGFDMExec::GetHoldDown, &FGFDMExec::SetHoldDown);
+  BindScheduler();
 
   Constructing = false;
 }
@@ -425,10 +525,8 @@ bool FGFDMExec::Run(void)
   // returns true if success, false if complete
   if (Script && !IntegrationSuspended()) success = Script->RunScript();
 
-  for (unsigned int i = 0; i < Models.size(); i++) {
-    LoadInputs(i);
-    Models[i]->Run(holding);
-  }
+  for (unsigned int i = 0; i < Models.size(); i++)
+    RunModel(i);
 
   if (Terminate) success = false;
 
@@ -437,6 +535,217 @@ bool FGFDMExec::Run(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGFDMExec::RunUntil(double simTime, const string& condition)
+{
+  unique_ptr<FGCondition> stop(BuildStopCondition(condition));
+  bool success = true;
+
+  // Half a time step of tolerance so that the rounding errors accumulated in
+  // sim_time do not trigger an extra frame.
+  while (success && sim_time < simTime - 0.5*dT) {
+    double time = sim_time;
+    success = Run();
+    if (sim_time <= time) break;
+    if (stop && stop->Evaluate()) break;
+  }
+
+  return success;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGFDMExec::RunFrames(unsigned int frames, const string& condition)
+{
+  unique_ptr<FGCondition> stop(BuildStopCondition(condition));
+  bool success = true;
+
+  for (unsigned int i = 0; success && i < frames; i++) {
+    success = Run();
+    if (stop && stop->Evaluate()) break;
+  }
+
+  return success;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Builds a condition from tests separated by a new line.
+
+FGCondition* FGFDMExec::BuildStopCondition(const string& condition)
+{
+  Element_ptr el = new Element("condition");
+
+  for (auto& test: split(condition, '\n')) {
+    if (!trim(test).empty()) el->AddData(test);
+  }
+
+  if (el->GetNumDataLines() == 0) return nullptr;
+
+  return new FGCondition(el, instance);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::RunModel(unsigned int idx)
+{
+  FGModel* model = Models[idx].get();
+  const unsigned int substeps = model->GetSubSteps();
+  FGProfiler::Scope scope(Profiler.get(), ModelSections[idx]);
+
+  for (unsigned int step = 0; step < substeps; step++) {
+    LoadInputs(idx);
+    model->Run(holding);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::BindScheduler(void)
+{
+  typedef int (FGFDMExec::*iPMF)(int) const;
+  typedef void (FGFDMExec::*vPMF)(int, int);
+
+  for (int i = 0; i < eNumStandardModels; i++) {
+    string base = string("simulation/scheduler/") + ModelNames[i];
+    instance->Tie(base + "/rate", this, i, (iPMF)&FGFDMExec::GetModelRate,
+                  (vPMF)&FGFDMExec::SetModelRate);
+    instance->Tie(base + "/substeps", this, i,
+                  (iPMF)&FGFDMExec::GetModelSubSteps,
+                  (vPMF)&FGFDMExec::SetModelSubSteps);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int FGFDMExec::GetModelRate(int idx) const
+{
+  if (idx < 0 || idx >= (int)Models.size()) return 0;
+  return Models[idx]->GetRate();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int FGFDMExec::GetModelSubSteps(int idx) const
+{
+  if (idx < 0 || idx >= (int)Models.size()) return 0;
+  return Models[idx]->GetSubSteps();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::SetModelRate(int idx, int rate)
+{
+  if (idx < 0 || idx >= (int)Models.size()) {
+    cerr << "Illegal model index " << idx << " for the scheduler." << endl;
+    return;
+  }
+
+  if (rate < 1) {
+    cerr << "The rate of the model " << ModelNames[idx]
+         << " must be a positive integer." << endl;
+    return;
+  }
+
+  if ((unsigned int)rate == Models[idx]->GetRate()) return;
+
+  if (rate > 1 && Models[idx]->GetSubSteps() > 1) {
+    cerr << "The model " << ModelNames[idx] << " is sub-stepped and can not"
+         << " be run at a lower rate." << endl;
+    return;
+  }
+
+  // The flight control components get their time step when they are built.
+  if (idx == eSystems && modelLoaded) {
+    cerr << "The rate of the model " << ModelNames[idx]
+         << " must be set before the aircraft is loaded." << endl;
+    return;
+  }
+
+  Models[idx]->SetRate(rate);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::SetModelSubSteps(int idx, int substeps)
+{
+  if (idx < 0 || idx >= (int)Models.size()) {
+    cerr << "Illegal model index " << idx << " for the scheduler." << endl;
+    return;
+  }
+
+  if (substeps < 1) {
+    cerr << "The number of sub-steps of the model " << ModelNames[idx]
+         << " must be a positive integer." << endl;
+    return;
+  }
+
+  if ((unsigned int)substeps == Models[idx]->GetSubSteps()) return;
+
+  if (substeps > 1) {
+    // The other models are not given the sub-step time step: running them
+    // several times per frame would only compute the same forces again or
+    // update their state several times with the frame time step.
+    if (idx != eSystems) {
+      cerr << "The model " << ModelNames[idx] << " can not be sub-stepped."
+           << endl;
+      return;
+    }
+
+    if (Models[idx]->GetRate() > 1) {
+      cerr << "The model " << ModelNames[idx] << " is run at a lower rate and"
+           << " can not be sub-stepped." << endl;
+      return;
+    }
+  }
+
+  // The flight control components get their time step when they are built.
+  if (idx == eSystems && modelLoaded) {
+    cerr << "The number of sub-steps of the model " << ModelNames[idx]
+         << " must be set before the aircraft is loaded." << endl;
+    return;
+  }
+
+  Models[idx]->SetSubSteps(substeps);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::PrintScheduleReport(void) const
+{
+  double total = 0.0;
+  for (int id: ModelSections) total += Profiler->GetSection(id).total;
+
+  ios::fmtflags flags = cout.flags();
+  streamsize precision = cout.precision();
+
+  cout << fixed << endl << "  " << fgblue << highint << underon
+       << "Models schedule for " << modelName << reset << endl << endl;
+  cout << "    " << left << setw(20) << "Model" << right << setw(6) << "Rate"
+       << setw(10) << "Substeps" << setw(14) << "Step dt (s)" << setw(12)
+       << "Frames" << setw(14) << "Mean (us)" << setw(10) << "Share" << endl;
+
+  for (unsigned int i = 0; i < Models.size(); i++) {
+    const FGProfiler::Section& timing = Profiler->GetSection(ModelSections[i]);
+    double mean = timing.calls > 0 ? 1E6 * timing.total / timing.calls : 0.0;
+    double share = total > 0.0 ? 100. * timing.total / total : 0.0;
+
+    cout << "    " << left << setw(20) << ModelNames[i] << right << setw(6)
+         << Models[i]->GetRate() << setw(10) << Models[i]->GetSubSteps()
+         << setw(14) << setprecision(6) << Models[i]->GetStepDeltaT(dT)
+         << setw(12) << timing.calls << setw(14) << setprecision(3) << mean
+         << setw(9) << setprecision(1) << share << "%" << endl;
+  }
+
+  if (!Profiler->IsEnabled())
+    cout << endl << "    Timing is disabled (see simulation/profile/enabled)."
+         << endl;
+
+  cout << endl;
+  cout.flags(flags);
+  cout.precision(precision);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::LoadInputs(unsigned int idx)
 {
   switch(idx) {
@@ -459,7 +768,7 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     Winds->in.Tl2b             = Propagate->GetTl2b();
     Winds->in.Tw2b             = Auxiliary->GetTw2b();
     Winds->in.V                = Auxiliary->GetVt();
-    Winds->in.totalDeltaT      = dT * Winds->GetRate();
+    Winds->in.totalDeltaT      = Winds->GetStepDeltaT(dT);
     Winds->in.vLocation        = Propagate->GetLocation();
     break;
   case eAuxiliary:
@@ -512,7 +821,7 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     Propulsion->in.AeroPQR          = Auxiliary->GetAeroPQR();
     Propulsion->in.alpha            = Auxiliary->Getalpha();
     Propulsion->in.beta             = Auxiliary->Getbeta();
-    Propulsion->in.TotalDeltaT      = dT * Propulsion->GetRate();
+    Propulsion->in.TotalDeltaT      = Propulsion->GetStepDeltaT(dT);
     Propulsion->in.ThrottlePos      = FCS->GetThrottlePos();
     Propulsion->in.MixturePos       = FCS->GetMixturePos();
     Propulsion->in.ThrottleCmd      = FCS->GetThrottleCmd();
@@ -548,7 +857,7 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     GroundReactions->in.UVW             = Propagate->GetUVW();
     GroundReactions->in.DistanceAGL     = Propagate->GetDistanceAGL();
     GroundReactions->in.DistanceASL     = Propagate->GetAltitudeASL();
-    GroundReactions->in.TotalDeltaT     = dT * GroundReactions->GetRate();
+    GroundReactions->in.TotalDeltaT     = GroundReactions->GetStepDeltaT(dT);
     GroundReactions->in.WOW             = GroundReactions->GetWOW();
     GroundReactions->in.Location        = Propagate->GetLocation();
     GroundReactions->in.vXYZcg          = MassBalance->GetXYZcg();
@@ -771,16 +1080,35 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
   if (addModelToPath) FullAircraftPath.append(model);
   aircraftCfgFileName = FullAircraftPath/(model + ".xml");
 
+  SGPath image = FullAircraftPath/(model + ".jsbimg");
+  if (image.exists() && FGXMLFileRead::ReadImage(image, RootDir)
+      && debug_lvl > 0)
+    cout << "Using the aircraft image " << image.utf8Str() << endl;
+
   if (modelLoaded) {
     DeAllocate();
     Allocate();
   }
 
+  // Time spent in each phase of the loading (see the debug level 256).
+  vector<pair<string, double>> LoadTimes;
+  auto start = chrono::steady_clock::now();
+  auto Lap = [&LoadTimes, &start](const string& phase) {
+    auto now = chrono::steady_clock::now();
+    LoadTimes.emplace_back(phase, chrono::duration<double>(now - start).count());
+    start = now;
+  };
+
   int saved_debug_lvl = debug_lvl;
   FGXMLFileRead XMLFileRead;
   Element *document = XMLFileRead.LoadXMLDocument(aircraftCfgFileName); // "document" is a class member
+  ModelFiles = {aircraftCfgFileName};
+  Lap("aircraft file");
 
   if (document) {
+    PreloadFiles(document);
+    Lap("preload files");
+
     if (IsChild) debug_lvl = 0;
 
     ReadPrologue(document);
@@ -796,6 +1124,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
         return result;
       }
     }
+    Lap("file header");
 
     if (IsChild) debug_lvl = 0;
 
@@ -812,6 +1141,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
       IC->InitializeIC();
       InitializeModels();
     }
+    Lap("planet");
 
     // Process the metrics element. This element is REQUIRED.
     element = document->FindElement("metrics");
@@ -825,6 +1155,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
       cerr << endl << "No metrics element was found in the aircraft config file." << endl;
       return false;
     }
+    Lap("metrics");
 
     // Process the mass_balance element. This element is REQUIRED.
     element = document->FindElement("mass_balance");
@@ -838,6 +1169,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
       cerr << endl << "No mass_balance element was found in the aircraft config file." << endl;
       return false;
     }
+    Lap("mass_balance");
 
     // Process the ground_reactions element. This element is REQUIRED.
     element = document->FindElement("ground_reactions");
@@ -853,6 +1185,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
       cerr << endl << "No ground_reactions element was found in the aircraft config file." << endl;
       return false;
     }
+    Lap("ground_reactions");
 
     // Process the external_reactions element. This element is OPTIONAL.
     element = document->FindElement("external_reactions");
@@ -863,6 +1196,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
         return result;
       }
     }
+    Lap("external_reactions");
 
     // Process the buoyant_forces element. This element is OPTIONAL.
     element = document->FindElement("buoyant_forces");
@@ -873,6 +1207,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
         return result;
       }
     }
+    Lap("buoyant_forces");
 
     // Process the propulsion element. This element is OPTIONAL.
     element = document->FindElement("propulsion");
@@ -885,6 +1220,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
       for (unsigned int i=0; i < Propulsion->GetNumEngines(); i++)
         FCS->AddThrottle();
     }
+    Lap("propulsion");
 
     // Process the system element[s]. This element is OPTIONAL, and there may be more than one.
     element = document->FindElement("system");
@@ -896,6 +1232,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
       }
       element = document->FindNextElement("system");
     }
+    Lap("systems");
 
     // Process the autopilot element. This element is OPTIONAL.
     element = document->FindElement("autopilot");
@@ -906,6 +1243,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
         return result;
       }
     }
+    Lap("autopilot");
 
     // Process the flight_control element. This element is OPTIONAL.
     element = document->FindElement("flight_control");
@@ -916,6 +1254,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
         return result;
       }
     }
+    Lap("flight_control");
 
     // Process the aerodynamics element. This element is OPTIONAL, but almost always expected.
     element = document->FindElement("aerodynamics");
@@ -928,6 +1267,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     } else {
       cerr << endl << "No expected aerodynamics element was found in the aircraft config file." << endl;
     }
+    Lap("aerodynamics");
 
     // Process the input element. This element is OPTIONAL, and there may be more than one.
     element = document->FindElement("input");
@@ -937,6 +1277,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
 
       element = document->FindNextElement("input");
     }
+    Lap("input");
 
     // Process the output element[s]. This element is OPTIONAL, and there may be
     // more than one.
@@ -947,6 +1288,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
 
       element = document->FindNextElement("output");
     }
+    Lap("output");
 
     // Lastly, process the child element. This element is OPTIONAL - and NOT YET SUPPORTED.
     element = document->FindElement("child");
@@ -958,6 +1300,10 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
       }
     }
 
+    // All the FCS components are now known.
+    FCS->AnalyzeDependencies();
+    Lap("fcs dependencies");
+
     // Since all vehicle characteristics have been loaded, place the values in the Inputs
     // structure for the FGModel-derived classes.
     LoadModelConstants();
@@ -979,6 +1325,24 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     masterPCS.base_string = "";
     masterPCS.node = Root;
     BuildPropertyCatalog(&masterPCS);
+    Lap("property catalog");
+  }
+
+  if (debug_lvl & 256) {
+    double total = 0.0;
+    ios::fmtflags flags = cout.flags();
+    streamsize precision = cout.precision();
+    cout << endl << "  Time spent loading " << model << ":" << endl
+         << fixed << setprecision(2);
+    for (auto& phase: LoadTimes) {
+      cout << "    " << left << setw(22) << phase.first << right << setw(10)
+           << 1000.0*phase.second << " ms" << endl;
+      total += phase.second;
+    }
+    cout << "    " << left << setw(22) << "Total" << right << setw(10)
+         << 1000.0*total << " ms" << endl;
+    cout.flags(flags);
+    cout.precision(precision);
   }
 
   return result;
@@ -986,6 +1350,131 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGFDMExec::WriteModelImage(const SGPath& filename) const
+{
+  if (!modelLoaded) {
+    cerr << "Error: no model is loaded, the image can not be written." << endl;
+    return false;
+  }
+
+  SGPath image = filename;
+  if (image.isNull()) image = FullAircraftPath/(modelName + ".jsbimg");
+
+  return FGXMLFileRead::WriteImage(image, ModelFiles, RootDir);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGFDMExec* FGFDMExec::Clone(void)
+{
+  if (!modelLoaded) {
+    cerr << "Error: no model is loaded, the executive can not be cloned." << endl;
+    return nullptr;
+  }
+
+  FGDebugSilencer silencer;
+
+  auto clone = std::make_unique<FGFDMExec>();
+  clone->RootDir = RootDir;
+  clone->AircraftPath = AircraftPath;
+  clone->EnginePath = EnginePath;
+  clone->SystemsPath = SystemsPath;
+  clone->OutputPath = OutputPath;
+  clone->dT = dT;
+  clone->saved_dT = saved_dT;
+
+  // The flight control components get their time step when they are built so
+  // the scheduler settings must be copied before the model is loaded.
+  for (unsigned int i=0; i < Models.size(); i++) {
+    clone->Models[i]->SetRate(Models[i]->GetRate());
+    clone->Models[i]->SetSubSteps(Models[i]->GetSubSteps());
+  }
+
+  // The XML documents are served by the cache: no file is parsed.
+  if (!clone->LoadModel(modelName, FullAircraftPath != AircraftPath))
+    return nullptr;
+
+  clone->Input->Disable();
+  clone->Output->Disable();
+
+  // The initial conditions are copied as a whole: setting the "ic/" properties
+  // one by one would depend on the order in which they are set.
+  auto CopyProperties = [this, &clone](bool tied) {
+    SGPropertyNode* source = instance->GetNode();
+    SGPropertyNode* target = clone->instance->GetNode();
+    for (int i=0; i < source->nChildren(); i++) {
+      SGPropertyNode* node = source->getChild(i);
+      if (node->getNameString() == "ic") continue;
+      SGPropertyNode* clone_node = target->getChild(node->getNameString(),
+                                                    node->getIndex(), false);
+      if (clone_node) CopyPropertyValues(node, clone_node, tied);
+    }
+    // The properties declared with an absolute path (such as
+    // "/instrumentation/...") are outside the tree of the executive.
+    for (int i=0; i < Root->nChildren(); i++) {
+      SGPropertyNode* node = Root->getChild(i);
+      if (node->getNameString() == "fdm") continue;
+      SGPropertyNode* clone_node = clone->Root->getChild(node->getNameString(),
+                                                         node->getIndex(),
+                                                         false);
+      if (clone_node) CopyPropertyValues(node, clone_node, tied);
+    }
+    clone->IC->CopyFrom(*IC);
+  };
+
+  CopyProperties(true);
+
+  // The planet is copied after the properties since writing back the terrain
+  // elevation read from the properties is not exact.
+  if (!clone->Inertial->CopyPlanet(*Inertial))
+    cerr << "Warning: the ground callback can not be copied. The clone uses "
+         << "the default ground callback." << endl;
+  clone->LoadPlanetConstants();
+
+  // Same steps than RunIC() except that the input and output are left
+  // uninitialized.
+  clone->SuspendIntegration();
+  clone->Initialize(clone->IC.get());
+  clone->Run();
+  clone->Propagate->InitializeDerivatives();
+  clone->ResumeIntegration();
+
+  for (unsigned int n=0; n < clone->Propulsion->GetNumEngines(); ++n) {
+    if (clone->IC->IsEngineRunning(n)) {
+      try {
+        clone->Propulsion->InitRunning(n);
+      } catch (const string& str) {
+        cerr << str << endl;
+        return nullptr;
+      }
+    }
+  }
+
+  // The executive has been run or trimmed: copy the current state. The models
+  // copy their internal states and the properties that they do not own (such
+  // as the outputs of the flight control components) are copied again. The
+  // properties tied to the models are not copied a second time since reading
+  // and writing them back is not always exact (e.g. the position properties
+  // go through the geodetic conversions). The clone is not run afterwards: it
+  // is already in the state in which the original is before its next frame.
+  if (Frame > 0 || trim_completed) {
+    CopyProperties(false);
+    for (unsigned int i=0; i < Models.size(); i++)
+      clone->Models[i]->CopyState(*Models[i]);
+    clone->sim_time = sim_time;
+    clone->Inertial->SetTime(sim_time);
+    clone->Frame = Frame;
+  }
+
+  clone->holding = holding;
+  clone->Terminate = Terminate;
+  *clone->RandomEngine = *RandomEngine;
+
+  return clone.release();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGFDMExec::GetPropulsionTankReport() const
 {
   return Propulsion->GetPropulsionTankReport();
@@ -1078,6 +1567,67 @@ bool FGFDMExec::ReadFileHeader(Element* el)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFDMExec::PreloadFiles(Element* document)
+{
+  // The directories are searched in the same order as the models do (see the
+  // methods FindFullPathName of FGModel, FGFCS and FGPropulsion).
+  const vector<SGPath> aircraftDirs = {FullAircraftPath};
+  const vector<SGPath> systemsDirs = {FullAircraftPath,
+                                      FullAircraftPath/string("Systems"),
+                                      SystemsPath};
+  const vector<SGPath> enginesDirs = {FullAircraftPath/string("Engines"),
+                                      EnginePath};
+  vector<SGPath> files;
+
+  auto AddFile = [&files](Element* el, const vector<SGPath>& dirs) {
+    string fname = el->GetAttributeValue("file");
+    if (fname.empty()) return;
+
+    SGPath path(SGPath::fromUtf8(fname.c_str()));
+    if (!path.isRelative()) {
+      files.push_back(path);
+      return;
+    }
+
+    for (auto& dir: dirs) {
+      SGPath name = CheckPathName(dir, path);
+      if (!name.isNull()) {
+        files.push_back(name);
+        return;
+      }
+    }
+  };
+
+  for (unsigned int i=0; i<document->GetNumElements(); ++i) {
+    Element* el = document->GetElement(i);
+    const string& name = el->GetName();
+
+    if (name == "system")
+      AddFile(el, systemsDirs);
+    else if (name == "propulsion") {
+      AddFile(el, aircraftDirs);
+      for (unsigned int j=0; j<el->GetNumElements(); ++j) {
+        Element* engine = el->GetElement(j);
+        if (engine->GetName() != "engine") continue;
+
+        AddFile(engine, enginesDirs);
+        Element* thruster = engine->FindElement("thruster");
+        if (thruster) AddFile(thruster, enginesDirs);
+      }
+    }
+    else if (name == "metrics" || name == "mass_balance"
+             || name == "ground_reactions" || name == "external_reactions"
+             || name == "buoyant_forces" || name == "autopilot"
+             || name == "flight_control" || name == "aerodynamics")
+      AddFile(el, aircraftDirs);
+  }
+
+  ModelFiles.insert(ModelFiles.end(), files.begin(), files.end());
+  FGXMLFileRead::Preload(files);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGFDMExec::ReadPrologue(Element* el) // el for ReadPrologue is the document element
 {
   bool result = true; // true for success
@@ -47,6 +47,7 @@ INCLUDES
 #include "models/FGPropagate.h"
 #include "models/FGOutput.h"
 #include "math/FGTemplateFunc.h"
+#include "input_output/FGProfiler.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -70,6 +71,7 @@ class FGInertial;
 class FGInput;
 class FGPropulsion;
 class FGMassBalance;
+class FGCondition;
 
 class TrimFailureException : public JSBBaseException {
   public:
@@ -165,8 +167,61 @@ CLASS DOCUMENTATION
        are printed out periodically
     - <b>16</b>: When set various parameters are sanity checked and
        a message is printed out when they go out of bounds
+    - <b>256</b>: When set, LoadModel() prints the time spent loading each
+       part of the model
+
+    <h3>Multirate scheduling</h3>
+
+    Each model is executed once per frame by default. The scheduler allows a
+    model to be run at a lower rate (every N frames, see SetModelRate()) or to
+    be sub-stepped N times per frame with a time step of dt/N (see
+    SetModelSubSteps()). Only the flight control systems can be sub-stepped
+    since their components are the only ones that integrate with the sub-step
+    time step, while models that vary slowly (aerodynamics, atmosphere, etc.)
+    can be run at a lower rate. Individual flight control channels can be
+    sub-stepped as well by means of the <tt>substeps</tt> attribute of the
+    <tt>&lt;channel&gt;</tt> element (see FGFCSChannel). The time spent in each
+    model can be monitored with the profiler (see GetProfiler()) and
+    PrintScheduleReport() to tune the schedule.
+
+    <h3>Profiling</h3>
+
+    The time spent in each model, flight control channel and named function is
+    measured by a FGProfiler when it is enabled, either from the code with
+    GetProfiler()->Enable() or by setting the property
+    <tt>simulation/profile/enabled</tt> to 1. The statistics are then published
+    under <tt>simulation/profile/</tt>.
+
+    <h3>Aircraft images</h3>
+
+    The XML files of an aircraft (aircraft, engines, systems, etc.) can be
+    saved to a binary image with WriteModelImage() once the model is loaded.
+    When a file <tt>&lt;model&gt;.jsbimg</tt> is found next to the aircraft
+    file, LoadModel() reads the image instead of parsing the XML files. The
+    files that have been modified since the image was written are still read
+    from XML (see FGXMLFileRead).
+
+    Before the models are loaded, the files referenced by the aircraft file
+    (engines, thrusters, systems, aerodynamics, etc.) are parsed in parallel
+    with FGXMLFileRead::Preload(). The models are then loaded one after the
+    other from the parsed documents, so the property tree is built in the same
+    order whatever the number of threads.
+
+    <h3>Cloning</h3>
+
+    Clone() creates a new executive with the same model, initial conditions
+    and state as an executive that has already been loaded and initialized.
+    The model is built from the documents of the XML cache so the clone does
+    not parse any file. This is the starting point of Monte Carlo runs or of
+    linearizations performed in parallel around the same state.
 
     <h3>Properties</h3>
+    @property simulation/scheduler/<model>/rate the model is executed every
+              <i>rate</i> frames.
+    @property simulation/scheduler/<model>/substeps number of times the model
+              is executed per frame. Only <tt>systems</tt> can be sub-stepped
+              and its number of sub-steps must be set before the aircraft is
+              loaded.
     @property simulator/do_trim (write only) Can be set to the integer equivalent to one of
                                 tLongitudinal (0), tFull (1), tGround (2), tPullup (3),
                                 tCustom (4), tTurn (5). Setting this to a legal value
@@ -247,6 +302,61 @@ public:
       @return true if successful, false if sim should be ended  */
   bool Run(void);
 
+  /** Executes frames until the simulation time is reached.
+      This is equivalent to calling Run() in a loop but the caller only
+      regains control at the end, which avoids the overhead of one call per
+      frame from a scripting language.
+      @param simTime the frames are executed until GetSimTime() is within
+                     half a time step of simTime or greater.
+      @param condition an optional stop condition with the syntax of the
+                       tests of the script conditions (for instance
+                       "position/h-agl-ft lt 10"). Several tests separated by
+                       a new line must all pass. The condition is evaluated
+                       after each frame and the execution stops when it is
+                       true.
+      @return false if Run() returned false (i.e. the sim should be ended),
+              true otherwise. The execution also stops if the simulation
+              time does not progress (holding or suspended integration). */
+  bool RunUntil(double simTime, const std::string& condition="");
+
+  /** Executes a number of frames.
+      @param frames the number of frames to execute.
+      @param condition an optional stop condition (see RunUntil()).
+      @return false if Run() returned false (i.e. the sim should be ended),
+              true otherwise. */
+  bool RunFrames(unsigned int frames, const std::string& condition="");
+
+  /** Sets the rate at which a model is executed.
+      @param idx the index of the model (see eModels)
+      @param rate the model is executed every <i>rate</i> frames. */
+  void SetModelRate(int idx, int rate);
+
+  /** Gets the rate at which a model is executed.
+      @param idx the index of the model (see eModels)
+      @return the number of frames between two executions of the model. */
+  int GetModelRate(int idx) const;
+
+  /** Sets the number of sub-steps executed by a model at each frame.
+      The model is then executed <i>substeps</i> times per frame with a time
+      step of dt/substeps. A model can either be run at a lower rate or be
+      sub-stepped but not both. Only the flight control systems (eSystems) can
+      be sub-stepped.
+      @param idx the index of the model (see eModels)
+      @param substeps number of sub-steps per frame. */
+  void SetModelSubSteps(int idx, int substeps);
+
+  /** Gets the number of sub-steps executed by a model at each frame.
+      @param idx the index of the model (see eModels)
+      @return the number of sub-steps per frame. */
+  int GetModelSubSteps(int idx) const;
+
+  /** Prints the schedule of the models and the time spent executing them.
+      The timings are only available if the profiler is enabled. */
+  void PrintScheduleReport(void) const;
+
+  /// Returns a pointer to the profiler of this FDM instance.
+  FGProfiler* GetProfiler(void) const { return Profiler.get(); }
+
   /** Initializes the sim from the initial condition object and executes
       each scheduled model without integrating i.e. dt=0.
       @return true if successful */
@@ -283,6 +393,48 @@ public:
       @return true if successful*/
   bool LoadModel(const std::string& model, bool addModelToPath = true);
 
+  /** Writes a binary image of the XML files of the loaded model.
+      The image contains the aircraft file and the files it references
+      (engines, thrusters, systems, etc.). Their paths are stored relative to
+      the root directory.
+      @param filename name of the image. By default, the image is written in
+                      the aircraft directory as <tt>&lt;model&gt;.jsbimg</tt>
+                      where it is found by LoadModel().
+      @return true if successful */
+  bool WriteModelImage(const SGPath& filename=SGPath()) const;
+
+  /** Creates a copy of this executive.
+      The copy has its own property tree, loads the same model and gets the
+      values of all the readable and writable properties, the initial
+      conditions, the simulation time, the planet, the ground callback, the
+      state of the random number generator and the internal states of all the
+      models (see FGModel::CopyState()): the vehicle state including the past
+      derivatives used by the integrators, the FCS components (filters,
+      integrators, actuators, delay lines, etc.), the engines and their
+      thrusters, the tanks, the landing gears, the gas cells, etc. Whether it
+      is made after RunIC(), after a trim or while the executive is running,
+      the copy then produces exactly the same results as the original
+      executive.
+
+      The following data are not copied:
+      - the script, if any;
+      - the ground callbacks that do not implement FGGroundCallback::Clone().
+        The copy uses the default ground callback instead and a warning is
+        issued;
+      - the state of the C library random number generator which is shared by
+        all the executives. The runs that use the turbulence models, the
+        thermals or the noise of the sensors therefore diverge;
+      - the input and the output which are disabled in the copy. The functions
+        defined in the output are not evaluated by the copy;
+      - the counter of the updates of the vehicle location
+        (<tt>simulation/vehicle-location-updates</tt>) which depends on the
+        cached values of the location.
+
+      The messages are silenced while the copy is loaded.
+      @return a new executive that must be deleted by the caller or nullptr if
+              no model is loaded or if the model could not be loaded. */
+  FGFDMExec* Clone(void);
+
   /** Load a script
       @param Script The full path name and file name for the script to be loaded.
       @param deltaT The simulation integration step size, if given.  If no value
@@ -629,6 +781,9 @@ private:
   std::string modelName;
   SGPath AircraftPath;
   SGPath FullAircraftPath;
+  // The XML files of the model: the aircraft file and the files it references
+  // (see PreloadFiles()).
+  std::vector<SGPath> ModelFiles;
   SGPath EnginePath;
   SGPath SystemsPath;
   SGPath OutputPath;
@@ -677,15 +832,23 @@ private:
 
   std::vector <std::string> PropertyCatalog;
   std::vector <std::shared_ptr<childData>> ChildFDMList;
+  // The profiler must be declared before the models since the models keep a
+  // raw pointer to it.
+  std::shared_ptr<FGProfiler> Profiler;
+  std::vector <int> ModelSections;
   std::vector <std::shared_ptr<FGModel>> Models;
   std::map<std::string, FGTemplateFunc_ptr> TemplateFunctions;
 
   bool ReadFileHeader(Element*);
   bool ReadChild(Element*);
   bool ReadPrologue(Element*);
+  void PreloadFiles(Element*);
   void SRand(int sr);
   int  SRand(void) const {return RandomSeed;}
   void LoadInputs(unsigned int idx);
+  void RunModel(unsigned int idx);
+  FGCondition* BuildStopCondition(const std::string& condition);
+  void BindScheduler(void);
   void LoadPlanetConstants(void);
   void LoadModelConstants(void);
   bool Allocate(void);
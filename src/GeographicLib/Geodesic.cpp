@@ -206,7 +206,9 @@ namespace GeographicLib {
     // check, e.g., on verifying quadrants in atan2.  In addition, this
     // enforces some symmetries in the results returned.
 
-    real sbet1, cbet1, sbet2, cbet2, s12x, m12x;
+    // s12x and m12x are scaled by _b below even when Lengths() is not asked to
+    // compute them: initialize them so that no garbage is multiplied.
+    real sbet1, cbet1, sbet2, cbet2, s12x = 0, m12x = 0;
 
     Math::sincosd(lat1, sbet1, cbet1); sbet1 *= _f1;
     // Ensure cbet1 = +epsilon at poles; doing the fix on beta means that sig12
@@ -43,6 +43,9 @@ INCLUDES
 #include "initialization/FGInitialCondition.h"
 #include "FGFDMExec.h"
 #include "input_output/FGXMLFileRead.h"
+#include "input_output/FGTerrainGroundCallback.h"
+#include "models/FGInertial.h"
+#include "math/FGTable.h"
 
 #if !defined(__GNUC__) && !defined(sgi) && !defined(_MSC_VER)
 #  include <time>
@@ -68,11 +71,13 @@ INCLUDES
 #  include <sys/time.h>
 #endif
 
+#include <iomanip>
 #include <iostream>
 #include <cstdlib>
 
 using namespace std;
 using JSBSim::FGXMLFileRead;
+using JSBSim::FGTable;
 using JSBSim::Element;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -83,6 +88,7 @@ SGPath RootDir;
 SGPath ScriptName;
 string AircraftName;
 SGPath ResetName;
+SGPath TerrainName;
 vector <string> LogOutputName;
 vector <SGPath> LogDirectiveName;
 vector <string> CommandLineProperties;
@@ -95,6 +101,11 @@ bool play_nice;
 bool suspend;
 bool catalog;
 bool nohighlight;
+bool schedule_report;
+bool profile;
+SGPath ProfileTraceName;
+bool write_image;
+SGPath ImageName;
 
 double end_time = 1e99;
 double simulation_rate = 1./120.;
@@ -336,6 +347,9 @@ int real_main(int argc, char* argv[])
   suspend = false;
   catalog = false;
   nohighlight = false;
+  schedule_report = false;
+  profile = false;
+  write_image = false;
 
   // *** PARSE OPTIONS PASSED INTO THIS SPECIFIC APPLICATION: JSBSim *** //
   success = options(argc, argv);
@@ -356,6 +370,20 @@ int real_main(int argc, char* argv[])
 
   if (nohighlight) FDMExec->disableHighLighting();
 
+  if (!TerrainName.isNull()) {
+    try {
+      auto terrain = std::make_shared<JSBSim::FGTerrain>(TerrainName);
+      auto inertial = FDMExec->GetInertial();
+      inertial->SetGroundCallback(
+        new JSBSim::FGTerrainGroundCallback(terrain, inertial->GetSemimajor(),
+                                            inertial->GetSemiminor()));
+    } catch (const JSBSim::JSBBaseException& e) {
+      cerr << e.what() << endl;
+      delete FDMExec;
+      exit(-1);
+    }
+  }
+
   if (simulation_rate < 1.0 )
     FDMExec->Setdt(simulation_rate);
   else
@@ -457,8 +485,19 @@ int real_main(int argc, char* argv[])
     }
   }
 
+  if (write_image) {
+    if (!FDMExec->WriteModelImage(ImageName)) {
+      delete FDMExec;
+      exit(-1);
+    }
+    cout << "Aircraft image written." << endl;
+  }
+
   FDMExec->RunIC();
 
+  if (profile || schedule_report)
+    FDMExec->GetProfiler()->Enable(!ProfileTraceName.isNull());
+
   // PRINT SIMULATION CONFIGURATION
   FDMExec->PrintSimulationConfiguration();
 
@@ -574,6 +613,26 @@ int real_main(int argc, char* argv[])
   strftime(s, 99, "%A %B %d %Y %X", &local);
   cout << "End: " << s << " (HH:MM:SS)" << endl;
 
+  if (schedule_report) FDMExec->PrintScheduleReport();
+  if (profile) {
+    FDMExec->GetProfiler()->PrintReport(cout);
+    FGXMLFileRead::CacheStatistics xml = FGXMLFileRead::GetCacheStatistics();
+    unsigned long loads = xml.hits + xml.misses;
+    cout << "XML documents cache: " << xml.hits << " hits out of " << loads
+         << " loads (" << fixed << setprecision(1)
+         << (loads ? 100.0*xml.hits/loads : 0.0) << "%), "
+         << xml.documents << " documents cached" << endl;
+    FGTable::MemoryUsage tables = FGTable::GetMemoryUsage();
+    cout << "Tables data: " << tables.tables << " tables share "
+         << tables.buffers << " buffers using " << tables.bytes/1024.0
+         << " kB (" << tables.unsharedBytes/1024.0 << " kB without sharing)"
+         << endl;
+    if (!ProfileTraceName.isNull()) {
+      if (FDMExec->GetProfiler()->WriteTrace(ProfileTraceName))
+        cout << "Profiling trace written to " << ProfileTraceName.utf8Str() << endl;
+    }
+  }
+
   // CLEAN UP
   delete FDMExec;
 
@@ -673,6 +732,14 @@ bool options(int count, char **arg)
         exit(1);
       }
 
+    } else if (keyword == "--terrain") {
+      if (n != string::npos) {
+        TerrainName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+
     } else if (keyword == "--property") {
       if (n != string::npos) {
          string propName = value.substr(0,value.find("="));
@@ -712,6 +779,14 @@ bool options(int count, char **arg)
         exit(1);
       }
 
+    } else if (keyword == "--schedule-report") {
+        schedule_report = true;
+    } else if (keyword == "--profile") {
+        profile = true;
+        if (!value.empty()) ProfileTraceName = SGPath::fromLocal8Bit(value.c_str());
+    } else if (keyword == "--write-image") {
+        write_image = true;
+        if (!value.empty()) ImageName = SGPath::fromLocal8Bit(value.c_str());
     } else if (keyword == "--catalog") {
         catalog = true;
         if (!value.empty()) AircraftName=value;
@@ -780,13 +855,24 @@ void PrintHelp(void)
     cout << "    --nohighlight  specifies that console output should be pure text only (no color)" << endl;
     cout << "    --suspend  specifies to suspend the simulation after initialization" << endl;
     cout << "    --initfile=<filename>  specifies an initilization file" << endl;
+    cout << "    --terrain=<path>  specifies the terrain elevation data: a SRTM tile (.hgt)," << endl;
+    cout << "                      a directory of SRTM tiles or a binary elevation grid (.dem)" << endl;
     cout << "    --catalog specifies that all properties for this aircraft model should be printed" << endl;
     cout << "              (catalog=aircraftname is an optional format)" << endl;
     cout << "    --property=<name=value> e.g. --property=simulation/integrator/rate/rotational=1" << endl;
     cout << "    --simulation-rate=<rate (double)> specifies the sim dT time or frequency" << endl;
     cout << "                      If rate specified is less than 1, it is interpreted as" << endl;
     cout << "                      a time step size, otherwise it is assumed to be a rate in Hertz." << endl;
-    cout << "    --end=<time (double)> specifies the sim end time" << endl << endl;
+    cout << "    --end=<time (double)> specifies the sim end time" << endl;
+    cout << "    --schedule-report  prints the models schedule and the time spent in each model" << endl;
+    cout << "                       at the end of the run" << endl;
+    cout << "                       e.g. --property=simulation/scheduler/systems/substeps=4" << endl;
+    cout << "    --profile[=<filename>]  prints the time spent in each model, channel and function" << endl;
+    cout << "                            at the end of the run. If a file name is given, each call" << endl;
+    cout << "                            is also saved to it in the Chrome trace format (JSON)" << endl;
+    cout << "    --write-image[=<filename>]  writes a binary image of the aircraft XML files that is" << endl;
+    cout << "                                used instead of the XML files by the next runs" << endl;
+    cout << "                                (default: <aircraft>.jsbimg in the aircraft directory)" << endl << endl;
 
     cout << "  NOTE: There can be no spaces around the = sign when" << endl;
     cout << "        an option is followed by a filename" << endl << endl;
@@ -150,6 +150,28 @@ void FGInitialCondition::InitializeIC(void)
 
 //******************************************************************************
 
+void FGInitialCondition::CopyFrom(const FGInitialCondition& ic)
+{
+  vUVW_NED = ic.vUVW_NED;
+  vPQR_body = ic.vPQR_body;
+  position = ic.position;
+  orientation = ic.orientation;
+  vt = ic.vt;
+  targetNlfIC = ic.targetNlfIC;
+  Tw2b = ic.Tw2b;
+  Tb2w = ic.Tb2w;
+  alpha = ic.alpha;
+  beta = ic.beta;
+  epa = ic.epa;
+  lastSpeedSet = ic.lastSpeedSet;
+  lastAltitudeSet = ic.lastAltitudeSet;
+  lastLatitudeSet = ic.lastLatitudeSet;
+  enginesRunning = ic.enginesRunning;
+  trimRequested = ic.trimRequested;
+}
+
+//******************************************************************************
+
 void FGInitialCondition::SetVequivalentKtsIC(double ve)
 {
   double altitudeASL = GetAltitudeASLFtIC();
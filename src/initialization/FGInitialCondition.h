@@ -687,6 +687,11 @@ public:
   /** Initialize the initial conditions to default values */
   void InitializeIC(void);
 
+  /** Copies the initial conditions of another instance. The instance remains
+      attached to its own FGFDMExec.
+      @param ic the initial conditions to copy */
+  void CopyFrom(const FGInitialCondition& ic);
+
   void bind(FGPropertyManager* pm);
 
 private:
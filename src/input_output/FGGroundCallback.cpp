@@ -38,6 +38,21 @@ namespace JSBSim {
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGGroundCallback::GetAGLevels(double t,
+                                   const std::vector<FGLocation>& locations,
+                                   std::vector<ContactPoint>& contacts) const
+{
+  contacts.resize(locations.size());
+
+  for (size_t i=0; i<locations.size(); i++) {
+    ContactPoint& c = contacts[i];
+    c.agl = GetAGLevel(t, locations[i], c.contact, c.normal, c.velocity,
+                       c.ang_velocity);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGDefaultGroundCallback::GetAGLevel(double t, const FGLocation& loc,
                                     FGLocation& contact, FGColumnVector3& normal,
                                     FGColumnVector3& vel, FGColumnVector3& angularVel) const
@@ -58,4 +73,21 @@ double FGDefaultGroundCallback::GetAGLevel(double t, const FGLocation& loc,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGDefaultGroundCallback::GetAGLevels(double t,
+                                      const std::vector<FGLocation>& locations,
+                                      std::vector<ContactPoint>& contacts) const
+{
+  contacts.resize(locations.size());
+
+  // Statically bound calls that the compiler can inline.
+  for (size_t i=0; i<locations.size(); i++) {
+    ContactPoint& c = contacts[i];
+    c.agl = FGDefaultGroundCallback::GetAGLevel(t, locations[i], c.contact,
+                                                c.normal, c.velocity,
+                                                c.ang_velocity);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 } // namespace JSBSim
@@ -38,10 +38,12 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-namespace JSBSim {
+#include <typeinfo>
+#include <vector>
+
+#include "math/FGLocation.h"
 
-class FGLocation;
-class FGColumnVector3;
+namespace JSBSim {
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -62,6 +64,19 @@ CLASS DECLARATION
 class FGGroundCallback
 {
 public:
+  /// Result of a ground query made with GetAGLevels()
+  struct ContactPoint {
+    /// Contact point location below the queried location
+    FGLocation contact;
+    /// Normal vector at the contact point
+    FGColumnVector3 normal;
+    /// Linear velocity at the contact point
+    FGColumnVector3 velocity;
+    /// Angular velocity at the contact point
+    FGColumnVector3 ang_velocity;
+    /// Altitude above ground of the queried location
+    double agl;
+  };
 
   FGGroundCallback() : time(0.0) {}
   virtual ~FGGroundCallback() {}
@@ -95,6 +110,52 @@ public:
                             FGColumnVector3& w) const
   { return GetAGLevel(time, location, contact, normal, v, w); }
 
+  /** Compute the altitude above ground of several locations at once.
+      This is used to query the ground below all the contact points of a
+      vehicle with a single call. The default implementation calls
+      GetAGLevel() for each location: implementations that have some overhead
+      per query (e.g. to look up the terrain data) should override this
+      method.
+      @param t simulation time
+      @param locations the locations to query
+      @param contacts returns the contact points below each location. The
+                      vector is resized to the number of locations.
+   */
+  virtual void GetAGLevels(double t, const std::vector<FGLocation>& locations,
+                           std::vector<ContactPoint>& contacts) const;
+
+  /** Compute the altitude above ground of several locations at once at the
+      current simulation time.
+      @see GetAGLevels(double, const std::vector<FGLocation>&,
+                       std::vector<ContactPoint>&) */
+  void GetAGLevels(const std::vector<FGLocation>& locations,
+                   std::vector<ContactPoint>& contacts) const
+  { GetAGLevels(time, locations, contacts); }
+
+  /** Compute an upper bound of the terrain elevation around a location.
+      This is used to skip the ground queries of a vehicle when it is flying
+      well above the terrain. The default implementation returns false so
+      that ground callbacks that do not implement this method (e.g. moving
+      objects such as carrier decks) are always queried.
+      @param t simulation time
+      @param location the center of the area
+      @param radius the horizontal radius of the area in feet
+      @param hmax returns the maximum elevation of the terrain above the
+                  ellipsoid within the area
+      @return true if hmax is a valid upper bound of the terrain elevation,
+              false if the bound is unknown.
+   */
+  virtual bool GetMaxTerrainElevation(double t, const FGLocation& location,
+                                      double radius, double& hmax) const
+  { return false; }
+
+  /** Compute an upper bound of the terrain elevation around a location at
+      the current simulation time.
+      @see GetMaxTerrainElevation(double, const FGLocation&, double, double&) */
+  bool GetMaxTerrainElevation(const FGLocation& location, double radius,
+                              double& hmax) const
+  { return GetMaxTerrainElevation(time, location, radius, hmax); }
+
   /** Set the terrain elevation.
       Only needs to be implemented if JSBSim should be allowed
       to modify the local terrain radius (see the default implementation)
@@ -107,6 +168,14 @@ public:
    */
   virtual void SetEllipse(double semimajor, double semiminor) {}
 
+  /** Create a copy of the ground callback.
+      This is used by FGFDMExec::Clone() to give the copy of an executive its
+      own ground callback. The default implementation returns nullptr: the
+      copy of the executive then keeps its default ground callback.
+      @return a new ground callback or nullptr if the ground callback does not
+              support copies. */
+  virtual FGGroundCallback* Clone(void) const { return nullptr; }
+
   /** Set the simulation time.
       The elapsed time can be used by the ground callbck to assess the planet
       rotation or the movement of objects.
@@ -128,11 +197,32 @@ public:
   explicit FGDefaultGroundCallback(double semiMajor, double semiMinor) :
     a(semiMajor), b(semiMinor) {}
 
+  using FGGroundCallback::GetAGLevel;
   double GetAGLevel(double t, const FGLocation& location,
                     FGLocation& contact,
                     FGColumnVector3& normal, FGColumnVector3& v,
                     FGColumnVector3& w) const override;
 
+  using FGGroundCallback::GetAGLevels;
+  void GetAGLevels(double t, const std::vector<FGLocation>& locations,
+                   std::vector<ContactPoint>& contacts) const override;
+
+  // The derived classes that override GetAGLevel() may model a terrain that
+  // is not flat: they must override GetMaxTerrainElevation() to be bounded.
+  using FGGroundCallback::GetMaxTerrainElevation;
+  bool GetMaxTerrainElevation(double t, const FGLocation& location,
+                              double radius, double& hmax) const override {
+    if (typeid(*this) != typeid(FGDefaultGroundCallback)) return false;
+    hmax = mTerrainElevation;
+    return true;
+  }
+
+  // The derived classes must override Clone() to be copied.
+  FGGroundCallback* Clone(void) const override {
+    if (typeid(*this) != typeid(FGDefaultGroundCallback)) return nullptr;
+    return new FGDefaultGroundCallback(*this);
+  }
+
   void SetTerrainElevation(double h) override
   { mTerrainElevation = h; }
 
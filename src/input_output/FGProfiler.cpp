@@ -0,0 +1,308 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGProfiler.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Measures the time spent in the models, channels and functions.
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+#include "FGProfiler.h"
+#include "FGPropertyManager.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+GLOBAL DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const char* const CategoryNames[FGProfiler::eNumCategories] = {
+  "models", "channels", "functions" };
+
+// Converts a section name to a valid property path: the characters that are
+// not allowed in a property name are replaced by '_' and each node name is
+// made to start with a letter or '_'.
+static string SanitizeName(const string& name)
+{
+  string path;
+  bool startNode = true;
+
+  for (char c: name) {
+    if (c == '/') {
+      if (!startNode) path += c;
+      startNode = true;
+      continue;
+    }
+    if (!isalnum(c) && c != '_' && c != '-' && c != '.') c = '_';
+    if (startNode && !isalpha(c) && c != '_') path += '_';
+    path += c;
+    startNode = false;
+  }
+
+  if (path.empty() || path.back() == '/') path += '_';
+
+  return path;
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGProfiler::FGProfiler(std::shared_ptr<FGPropertyManager> pm, int _tid)
+  : enabled(false), tracing(false), tid(_tid), epoch(clock::now()),
+    PropertyManager(pm)
+{
+  typedef int (FGProfiler::*iPMF)(void) const;
+  PropertyManager->Tie("simulation/profile/enabled", this,
+                       (iPMF)&FGProfiler::GetEnabled, &FGProfiler::SetEnabled);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int FGProfiler::Register(eCategory category, const string& name)
+{
+  for (unsigned int i=0; i<Sections.size(); i++) {
+    if (Sections[i].category == category && Sections[i].name == name)
+      return i;
+  }
+
+  Section section;
+  section.name = name;
+  section.category = category;
+  section.calls = 0;
+  section.total = section.max = 0.0;
+  section.histogram.fill(0);
+  section.bound = false;
+  Sections.push_back(section);
+
+  int id = Sections.size()-1;
+
+  // The properties are only created for the sections registered while the
+  // profiler is enabled, the others are bound when the profiler is enabled.
+  if (enabled) Bind(id);
+
+  return id;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::Bind(int id)
+{
+  Section& section = Sections[id];
+  if (section.bound) return;
+
+  string base = string("simulation/profile/") + CategoryNames[section.category]
+              + "/" + SanitizeName(section.name);
+
+  // Properties that are already tied by another section (e.g. name clashes
+  // after sanitization) are silently skipped.
+  if (PropertyManager->HasNode(base + "/calls")) {
+    section.bound = true;
+    return;
+  }
+
+  PropertyManager->Tie(base + "/calls", this, id, &FGProfiler::GetCalls);
+  PropertyManager->Tie(base + "/total-sec", this, id, &FGProfiler::GetTotal);
+  PropertyManager->Tie(base + "/mean-us", this, id, &FGProfiler::GetMean);
+  PropertyManager->Tie(base + "/max-us", this, id, &FGProfiler::GetMax);
+  section.bound = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::Enable(bool trace)
+{
+  Reset();
+  tracing = trace;
+  enabled = true;
+
+  for (unsigned int i=0; i<Sections.size(); i++) Bind(i);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::Reset(void)
+{
+  for (auto& section: Sections) {
+    section.calls = 0;
+    section.total = section.max = 0.0;
+    section.histogram.fill(0);
+  }
+
+  Events.clear();
+  epoch = clock::now();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::Record(int id, clock::time_point start, clock::time_point end)
+{
+  Section& section = Sections[id];
+  chrono::duration<double> elapsed = end - start;
+  double dt = elapsed.count();
+
+  section.calls++;
+  section.total += dt;
+  if (dt > section.max) section.max = dt;
+
+  // The histogram bins are the powers of 2 of the duration in nanoseconds.
+  double ns = dt*1E9;
+  unsigned int bin = 0;
+  if (ns >= 1.0) {
+    int exponent;
+    frexp(ns, &exponent);
+    bin = min((unsigned int)exponent-1, NumBins-1);
+  }
+  section.histogram[bin]++;
+
+  if (tracing && Events.size() < MaxEvents) {
+    chrono::duration<double, micro> ts = start - epoch;
+    Events.push_back({id, ts.count(), dt*1E6});
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGProfiler::GetMean(int id) const
+{
+  const Section& section = Sections[id];
+  return section.calls > 0 ? 1E6*section.total/section.calls : 0.0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGProfiler::GetPercentile(int id, double p) const
+{
+  const Section& section = Sections[id];
+  unsigned long threshold = (unsigned long)ceil(p*section.calls);
+  unsigned long count = 0;
+
+  if (section.calls == 0) return 0.0;
+
+  for (unsigned int i=0; i<NumBins; i++) {
+    count += section.histogram[i];
+    if (count >= threshold) return min(ldexp(1E-9, i+1), section.max);
+  }
+
+  return section.max;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::PrintReport(ostream& out) const
+{
+  ios::fmtflags flags = out.flags();
+  streamsize precision = out.precision();
+
+  out << fixed << endl << "  " << fgblue << highint << underon
+      << "Profiling report" << reset << endl;
+
+  for (int c=0; c<eNumCategories; c++) {
+    vector<int> ids;
+    for (unsigned int i=0; i<Sections.size(); i++) {
+      if (Sections[i].category == c && Sections[i].calls > 0) ids.push_back(i);
+    }
+
+    if (ids.empty()) continue;
+
+    sort(ids.begin(), ids.end(), [this](int a, int b) {
+                                   return Sections[a].total > Sections[b].total;
+                                 });
+
+    out << endl << "    " << highint << CategoryNames[c] << normint << endl;
+    out << "    " << left << setw(40) << "Name" << right << setw(10) << "Calls"
+        << setw(12) << "Total (ms)" << setw(11) << "Mean (us)" << setw(11)
+        << "p50 (us)" << setw(11) << "p99 (us)" << setw(11) << "Max (us)"
+        << endl;
+
+    for (int id: ids) {
+      const Section& section = Sections[id];
+      string name = section.name;
+      if (name.size() > 39) name = "..." + name.substr(name.size()-36);
+      out << "    " << left << setw(40) << name << right << setw(10)
+          << section.calls << setprecision(3) << setw(12)
+          << 1E3*section.total << setw(11) << GetMean(id) << setw(11)
+          << 1E6*GetPercentile(id, 0.5) << setw(11)
+          << 1E6*GetPercentile(id, 0.99) << setw(11) << 1E6*section.max
+          << endl;
+    }
+  }
+
+  out << endl;
+  out.flags(flags);
+  out.precision(precision);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGProfiler::WriteTrace(const SGPath& filename) const
+{
+  ofstream trace(filename.utf8Str());
+
+  if (!trace.is_open()) {
+    cerr << "Could not open the trace file " << filename.utf8Str() << endl;
+    return false;
+  }
+
+  trace << fixed << setprecision(3) << "{\"traceEvents\":[";
+
+  for (unsigned int i=0; i<Events.size(); i++) {
+    const Event& event = Events[i];
+    const Section& section = Sections[event.section];
+    string name;
+
+    // Escape the characters that are not allowed in a JSON string.
+    for (char c: section.name) {
+      if (c == '"' || c == '\\') name += '\\';
+      if ((unsigned char)c >= 0x20) name += c;
+    }
+
+    if (i > 0) trace << ",";
+    trace << endl << "{\"name\":\"" << name << "\",\"cat\":\""
+          << CategoryNames[section.category] << "\",\"ph\":\"X\",\"ts\":"
+          << event.start << ",\"dur\":" << event.duration
+          << ",\"pid\":0,\"tid\":" << tid << "}";
+  }
+
+  trace << endl << "],\"displayTimeUnit\":\"ns\"}" << endl;
+
+  if (Events.size() == MaxEvents)
+    cerr << "The trace has been truncated to its first " << MaxEvents
+         << " events." << endl;
+
+  return true;
+}
+}
@@ -0,0 +1,190 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGProfiler.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGPROFILER_H
+#define FGPROFILER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <array>
+#include <chrono>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FGJSBBase.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGPropertyManager;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Measures the time spent in the models, the FCS channels and the functions.
+    Each instrumented piece of code is registered once as a <i>section</i>
+    which accumulates the number of calls, the total and maximum execution
+    times as well as an histogram of the execution times (bins are powers of 2
+    of nanoseconds). The measured times are inclusive: the time spent in a
+    model includes the time spent in the functions that it evaluates.
+
+    The profiler is disabled by default and then costs a single test per
+    section. Once enabled, the statistics are available as properties:
+
+    @property simulation/profile/enabled (read/write) enables the profiler
+    @property simulation/profile/<category>/<name>/calls number of calls
+    @property simulation/profile/<category>/<name>/total-sec total time
+    @property simulation/profile/<category>/<name>/mean-us mean time per call
+    @property simulation/profile/<category>/<name>/max-us maximum time
+
+    where <category> is one of <tt>models</tt>, <tt>channels</tt> or
+    <tt>functions</tt>. A report sorted by total time can be printed and the
+    individual calls can be recorded and saved in the Chrome trace format (the
+    file can then be opened with chrome://tracing or https://ui.perfetto.dev).
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGProfiler : public FGJSBBase
+{
+public:
+  typedef std::chrono::steady_clock clock;
+
+  enum eCategory { eModel=0, eChannel, eFunction, eNumCategories };
+
+  static constexpr unsigned int NumBins = 32;
+
+  struct Section {
+    std::string name;
+    eCategory category;
+    unsigned long calls;
+    double total; // seconds
+    double max;   // seconds
+    std::array<unsigned long, NumBins> histogram;
+    bool bound;
+  };
+
+  /** Measures the time elapsed between its construction and its destruction
+      and records it in a section of the profiler. Does nothing if the
+      profiler is disabled. */
+  class Scope {
+  public:
+    Scope(FGProfiler* p, int id)
+      : profiler(p && p->enabled && id >= 0 ? p : nullptr), section(id)
+    { if (profiler) start = clock::now(); }
+    ~Scope() { if (profiler) profiler->Record(section, start, clock::now()); }
+  private:
+    FGProfiler* profiler;
+    int section;
+    clock::time_point start;
+  };
+
+  /** Constructor
+      @param pm the property manager under which the statistics are bound.
+      @param tid the thread identifier used in the Chrome trace. */
+  FGProfiler(std::shared_ptr<FGPropertyManager> pm, int tid=0);
+
+  /** Registers a section. If a section with the same name already exists in
+      the category, it is reused.
+      @return the section identifier. */
+  int Register(eCategory category, const std::string& name);
+
+  /** Enables the profiler and resets the statistics.
+      @param trace if true each call is also recorded for the Chrome trace. */
+  void Enable(bool trace=false);
+  /// Disables the profiler. The statistics are kept.
+  void Disable(void) { enabled = false; }
+  bool IsEnabled(void) const { return enabled; }
+  /// Resets the statistics and the recorded trace.
+  void Reset(void);
+
+  /// Records a call to a section.
+  void Record(int id, clock::time_point start, clock::time_point end);
+
+  const Section& GetSection(int id) const { return Sections[id]; }
+  size_t GetNumSections(void) const { return Sections.size(); }
+
+  /** Estimates a percentile of the execution time of a section from its
+      histogram.
+      @param id section identifier
+      @param p percentile between 0 and 1
+      @return the upper bound in seconds of the histogram bin where the
+              percentile is located. */
+  double GetPercentile(int id, double p) const;
+
+  /// Prints the statistics of the sections sorted by decreasing total time.
+  void PrintReport(std::ostream& out) const;
+
+  /** Writes the recorded calls in the Chrome trace event format (JSON).
+      @return false if the file could not be written. */
+  bool WriteTrace(const SGPath& filename) const;
+
+private:
+  struct Event {
+    int section;
+    double start; // microseconds
+    double duration; // microseconds
+  };
+
+  // Maximum number of trace events recorded to bound the memory usage.
+  static constexpr size_t MaxEvents = 2000000;
+
+  bool enabled;
+  bool tracing;
+  int tid;
+  clock::time_point epoch;
+  std::vector<Section> Sections;
+  std::vector<Event> Events;
+  std::shared_ptr<FGPropertyManager> PropertyManager;
+
+  void Bind(int id);
+  int GetEnabled(void) const { return enabled; }
+  void SetEnabled(int e) { if (!e) Disable(); else if (!enabled) Enable(tracing); }
+  double GetCalls(int id) const { return Sections[id].calls; }
+  double GetTotal(int id) const { return Sections[id].total; }
+  double GetMean(int id) const;
+  double GetMax(int id) const { return 1E6*Sections[id].max; }
+};
+}
+#endif
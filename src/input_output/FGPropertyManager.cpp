@@ -333,4 +333,19 @@ void FGPropertyManager::Untie(SGPropertyNode *property)
   cerr << "Failed to untie property " << name << endl
        << "JSBSim is not the owner of this property." << endl;
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGPropertyList::FGPropertyList(FGPropertyManager* pm,
+                               const vector<string>& names, bool create)
+{
+  nodes.reserve(names.size());
+
+  for (const auto& name: names) {
+    FGPropertyNode* node = pm->GetNode(name, create);
+    if (!node)
+      throw JSBBaseException("No property named " + name);
+    nodes.push_back(node);
+  }
+}
 } // namespace JSBSim
@@ -612,5 +612,45 @@ class FGPropertyManager
     std::vector<SGPropertyNode_ptr> tied_properties;
     FGPropertyNode_ptr root;
 };
+
+/** Ordered list of properties which values are read or written in bulk.
+    The property names are resolved once by the constructor so that the values
+    of all the properties can then be copied to or from an array of doubles in
+    a single call. This is intended for the applications which exchange the
+    same set of properties with JSBSim at each time step, such as the
+    observations and the actions of a reinforcement learning environment.
+  */
+class FGPropertyList
+{
+  public:
+    /** Constructor
+        @param pm the property manager in which the properties are looked up.
+        @param names the names of the properties.
+        @param create true to create the properties that do not exist.
+        @throws JSBBaseException if a property does not exist and create is
+                false. */
+    FGPropertyList(FGPropertyManager* pm, const std::vector<std::string>& names,
+                   bool create = false);
+
+    /// Returns the number of properties in the list.
+    size_t GetSize(void) const { return nodes.size(); }
+
+    /** Copies the values of the properties to an array.
+        @param values array of at least GetSize() elements. */
+    void GetValues(double* values) const {
+      for (const auto& node: nodes)
+        *values++ = node->getDoubleValue();
+    }
+
+    /** Sets the values of the properties from an array.
+        @param values array of at least GetSize() elements. */
+    void SetValues(const double* values) {
+      for (auto& node: nodes)
+        node->setDoubleValue(*values++);
+    }
+
+  private:
+    std::vector<FGPropertyNode_ptr> nodes;
+};
 }
 #endif // FGPROPERTYMANAGER_H
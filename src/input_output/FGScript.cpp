@@ -61,7 +61,7 @@ CLASS IMPLEMENTATION
 
 // Constructor
 
-FGScript::FGScript(FGFDMExec* fgex) : FDMExec(fgex)
+FGScript::FGScript(FGFDMExec* fgex) : Listener(ActiveEvents), FDMExec(fgex)
 {
   PropertyManager=FDMExec->GetPropertyManager();
 
@@ -74,6 +74,8 @@ FGScript::~FGScript()
 {
   unsigned int i, j;
 
+  Listener.Clear();
+
   for (i=0; i<Events.size(); i++) {
     delete Events[i].Condition;
     for (j=0; j<Events[i].Functions.size(); j++)
@@ -360,6 +362,8 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
     event_element = run_element->FindNextElement("event");
   }
 
+  ScheduleEvents();
+
   Debug(4);
 
   return true;
@@ -374,6 +378,66 @@ void FGScript::ResetEvents(void)
 
   for (unsigned int i=0; i<Events.size(); i++)
     Events[i].reset();
+
+  ScheduleEvents();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::ScheduleEvents(void)
+{
+  FGPropertyNode* simTime = PropertyManager->GetNode("simulation/sim-time-sec");
+
+  ActiveEvents.clear();
+  TimedEvents = decltype(TimedEvents)();
+  Listener.Clear();
+
+  for (unsigned int i=0; i<Events.size(); i++) {
+    struct event &thisEvent = Events[i];
+
+    // Bind the properties that have been created since the script was loaded.
+    // The others will be bound when the event is triggered.
+    for (unsigned int j=0; j<thisEvent.SetParam.size(); j++) {
+      if (thisEvent.SetParam[j] == 0L
+          && PropertyManager->HasNode(thisEvent.SetParamName[j]))
+        thisEvent.SetParam[j] = PropertyManager->GetNode(thisEvent.SetParamName[j]);
+    }
+
+    thisEvent.EarliestTime = thisEvent.Condition->GetLowerBound(simTime);
+
+    // The value of the tied properties can change without notice so only the
+    // conditions that read untied properties can be watched.
+    vector<const FGPropertyNode*> nodes;
+    thisEvent.Watched = thisEvent.Condition->GetDependencies(nodes);
+    for (auto node: nodes) {
+      if (node->isTied() || node->isAlias()) {
+        thisEvent.Watched = false;
+        break;
+      }
+    }
+    if (thisEvent.Watched) {
+      for (auto node: nodes)
+        Listener.Watch(const_cast<FGPropertyNode*>(node), i);
+    }
+
+    if (thisEvent.EarliestTime > -HUGE_VAL)
+      TimedEvents.push(TimedEvent(thisEvent.EarliestTime, i));
+    else
+      ActiveEvents.insert(i);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGScript::IsIdle(const struct event& thisEvent) const
+{
+  if (!thisEvent.Triggered) return true;
+  if (thisEvent.Notify && !thisEvent.Notified) return false;
+
+  for (unsigned int i=0; i<thisEvent.Transiting.size(); i++)
+    if (thisEvent.Transiting[i]) return false;
+
+  return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -381,18 +445,31 @@ void FGScript::ResetEvents(void)
 bool FGScript::RunScript(void)
 {
   unsigned i, j;
-  unsigned event_ctr = 0;
 
   double currentTime = FDMExec->GetSimTime();
   double newSetValue = 0;
 
   if (currentTime > EndTime) return false;
 
-  // Iterate over all events.
-  for (unsigned int ev_ctr=0; ev_ctr < Events.size(); ev_ctr++) {
+  // Wake up the events whose condition may now be true.
+  while (!TimedEvents.empty() && TimedEvents.top().first <= currentTime) {
+    ActiveEvents.insert(TimedEvents.top().second);
+    TimedEvents.pop();
+  }
+
+  // Iterate over the active events in the order of the script. The events
+  // that are woken up while an event is executed are executed during the same
+  // time step if they come later in the script, and at the next one otherwise.
+  auto it = ActiveEvents.begin();
+  while (it != ActiveEvents.end()) {
 
+    unsigned int ev_ctr = *it;
     struct event &thisEvent = Events[ev_ctr];
 
+    // The event is removed while it is executed so that it is rescheduled if
+    // its actions modify a property that its condition reads.
+    ActiveEvents.erase(it);
+
     // Determine whether the set of conditional tests for this condition equate
     // to true and should cause the event to execute. If the conditions evaluate
     // to true, then the event is triggered. If the event is not persistent,
@@ -493,12 +570,12 @@ bool FGScript::RunScript(void)
                << endl;
           cout << "  <description>" << endl;
           cout << "  <![CDATA[" << endl;
-          cout << "  <b>" << thisEvent.Name << " (Event " << event_ctr << ")"
+          cout << "  <b>" << thisEvent.Name << " (Event " << ev_ctr << ")"
                << " executed at time: " << currentTime << "</b><br/>" << endl;
         } else  {
           cout << endl << underon
                << highint << thisEvent.Name << normint << underoff
-               << " (Event " << event_ctr << ")"
+               << " (Event " << ev_ctr << ")"
                << " executed at time: " << highint << currentTime << normint
                << endl;
         }
@@ -531,11 +608,49 @@ bool FGScript::RunScript(void)
 
     }
 
-    event_ctr++;
+    // An event that has no action pending is only executed again when its
+    // condition may change: a one-shot event is retired until the script is
+    // reset and a watched event is woken up when its properties are modified.
+    bool retired = thisEvent.Triggered && !thisEvent.Persistent
+                   && !thisEvent.Continuous;
+    if (!IsIdle(thisEvent) || !(retired || thisEvent.Watched))
+      ActiveEvents.insert(ev_ctr);
+
+    it = ActiveEvents.upper_bound(ev_ctr);
   }
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::EventListener::valueChanged(SGPropertyNode* node)
+{
+  auto watched = Events.find(node);
+
+  if (watched != Events.end())
+    Active.insert(watched->second.begin(), watched->second.end());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::EventListener::Watch(SGPropertyNode* node, unsigned int event)
+{
+  auto& events = Events[node];
+
+  if (events.empty()) node->addChangeListener(this);
+  events.push_back(event);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::EventListener::Clear(void)
+{
+  for (auto& watched: Events)
+    watched.first->removeChangeListener(this);
+
+  Events.clear();
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -40,6 +40,8 @@ INCLUDES
 #include <vector>
 #include <map>
 #include <memory>
+#include <queue>
+#include <set>
 
 #include "FGJSBBase.h"
 #include "FGPropertyReader.h"
@@ -157,6 +159,16 @@ CLASS DOCUMENTATION
     to be used are specified in the &quot;use&quot; lines. Next,
     comes the &quot;run&quot; section, where the conditions are
     described in &quot;event&quot; clauses.</p>
+
+    <p>The events are scheduled so that the conditions are only evaluated
+    when their result may have changed. An event whose condition cannot be
+    true before a given simulation time (such as <em>sim-time-sec >= 500</em>)
+    waits in a queue ordered by time, and an event whose condition only reads
+    properties that are not tied to the models is woken up when one of these
+    properties is modified. A one-shot event is retired once its actions are
+    completed. The events that are due are executed in the order of the script
+    so that the results are the same as when all the events are evaluated at
+    each time step.</p>
     @author Jon S. Berndt
 */
 
@@ -233,11 +245,15 @@ private:
     std::vector <double>  ValueSpan;
     std::vector <bool>    Transiting;
     std::vector <FGFunction*> Functions;
+    double           EarliestTime; // The condition is false before that time
+    bool             Watched;      // The condition only reads untied properties
 
     event() {
       Triggered = false;
       Persistent = false;
       Continuous = false;
+      EarliestTime = -HUGE_VAL;
+      Watched = false;
       Delay = 0.0;
       Notify = Notified = NotifyKML = false;
       Name = "";
@@ -252,15 +268,35 @@ private:
     }
   };
 
+  // Wakes up the events whose condition reads a modified property.
+  class EventListener : public SGPropertyChangeListener {
+  public:
+    explicit EventListener(std::set<unsigned int>& active) : Active(active) {}
+    void valueChanged(SGPropertyNode* node) override;
+    void Watch(SGPropertyNode* node, unsigned int event);
+    void Clear(void);
+  private:
+    std::set<unsigned int>& Active;
+    std::map<SGPropertyNode*, std::vector<unsigned int> > Events;
+  };
+
+  typedef std::pair<double, unsigned int> TimedEvent;
+
   std::string  ScriptName;
   double  StartTime;
   double  EndTime;
   std::vector <struct event> Events;
+  std::set<unsigned int> ActiveEvents;
+  std::priority_queue<TimedEvent, std::vector<TimedEvent>,
+                      std::greater<TimedEvent> > TimedEvents;
+  EventListener Listener;
 
   FGPropertyReader LocalProperties;
 
   FGFDMExec* FDMExec;
   std::shared_ptr<FGPropertyManager> PropertyManager;
+  void ScheduleEvents(void);
+  bool IsIdle(const struct event& thisEvent) const;
   void Debug(int from);
 };
 }
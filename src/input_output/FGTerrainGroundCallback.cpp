@@ -0,0 +1,628 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGTerrainGroundCallback.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Ground callback based on a digital elevation model.
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "FGTerrainGroundCallback.h"
+#include "math/FGLocation.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// A read only memory mapped elevation grid.
+class FGTerrainTile
+{
+public:
+  enum eFormat { eSRTM, eGrid };
+
+  FGTerrainTile(const SGPath& path, eFormat format);
+  ~FGTerrainTile();
+
+  bool Contains(double lat, double lon) const {
+    return lat >= south && lat <= north && lon >= west && lon <= east;
+  }
+
+  // Interpolates the elevation in meters and its derivatives in meters per
+  // degree. Returns false if the grid points around the location are voids.
+  bool Interpolate(double lat, double lon, double& h, double& dhdlat,
+                   double& dhdlon) const;
+
+  // Computes the maximum elevation in meters of the grid points around the
+  // part of the box [south, north]x[west, east] that is covered by the tile.
+  // Returns false if the grid points are voids or too numerous.
+  bool GetMaxElevation(double s, double n, double w, double e,
+                       double& hmax) const;
+
+private:
+  eFormat format;
+  unsigned int ncols, nrows;
+  double north, west, south, east, dlat, dlon;
+  const unsigned char* grid;
+  const unsigned char* data;
+  size_t size;
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  HANDLE file, mapping;
+#endif
+
+  double Sample(unsigned int row, unsigned int col) const;
+  void Map(const SGPath& path);
+  void Unmap(void);
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+GLOBAL DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const size_t GridHeaderSize = 48;
+static const short SRTMVoid = -32768;
+
+// The binary data is decoded byte by byte so that the files are read the same
+// regardless of the endianness of the host.
+static uint32_t ReadLE32(const unsigned char* p)
+{
+  return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16
+    | uint32_t(p[3]) << 24;
+}
+
+static double ReadLEDouble(const unsigned char* p)
+{
+  uint64_t bits = uint64_t(ReadLE32(p)) | uint64_t(ReadLE32(p+4)) << 32;
+  double value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Returns the cell index of the 1 degree square that contains (lat, lon)
+static int CellIndex(int lat, int lon)
+{
+  return (lat + 90) * 360 + lon + 180;
+}
+
+// Returns the name of the SRTM tile whose south west corner is at (lat, lon)
+static string SRTMName(int lat, int lon)
+{
+  ostringstream name;
+  name << (lat < 0 ? 'S' : 'N') << setfill('0') << setw(2) << abs(lat)
+       << (lon < 0 ? 'W' : 'E') << setw(3) << abs(lon) << ".hgt";
+  return name.str();
+}
+
+// Extracts the location of a SRTM tile from its file name (e.g. N37W123.hgt)
+static bool ParseSRTMName(const string& name, int& lat, int& lon)
+{
+  if (name.size() < 7) return false;
+
+  char ns = toupper(name[0]), ew = toupper(name[3]);
+  if ((ns != 'N' && ns != 'S') || (ew != 'E' && ew != 'W')) return false;
+
+  for (unsigned int i: {1, 2, 4, 5, 6})
+    if (!isdigit(name[i])) return false;
+
+  lat = stoi(name.substr(1, 2));
+  lon = stoi(name.substr(4, 3));
+  if (ns == 'S') lat = -lat;
+  if (ew == 'W') lon = -lon;
+
+  return true;
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGTerrainTile::FGTerrainTile(const SGPath& path, eFormat _format)
+  : format(_format), data(nullptr), size(0)
+{
+  Map(path);
+
+  if (format == eSRTM) {
+    int lat, lon;
+    unsigned int n = (unsigned int)sqrt(size/2);
+
+    if (!ParseSRTMName(path.file(), lat, lon) || n < 2 || 2*n*n != size) {
+      Unmap();
+      throw JSBBaseException(path.utf8Str() + " is not a valid SRTM tile.");
+    }
+
+    ncols = nrows = n;
+    dlat = dlon = 1.0 / (n-1);
+    north = lat + 1.0;
+    west = lon;
+    grid = data;
+  }
+  else {
+    if (size < GridHeaderSize || memcmp(data, "JSBDEM01", 8) != 0) {
+      Unmap();
+      throw JSBBaseException(path.utf8Str()
+                             + " is not a valid elevation grid file.");
+    }
+
+    ncols = ReadLE32(data+8);
+    nrows = ReadLE32(data+12);
+    west = ReadLEDouble(data+16);
+    north = ReadLEDouble(data+24);
+    dlon = ReadLEDouble(data+32);
+    dlat = ReadLEDouble(data+40);
+    grid = data + GridHeaderSize;
+
+    if (ncols < 2 || nrows < 2 || dlon <= 0.0 || dlat <= 0.0
+        || size - GridHeaderSize < 4 * size_t(ncols) * nrows) {
+      Unmap();
+      throw JSBBaseException(path.utf8Str()
+                             + " has an inconsistent header.");
+    }
+  }
+
+  south = north - (nrows-1)*dlat;
+  east = west + (ncols-1)*dlon;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTerrainTile::~FGTerrainTile()
+{
+  Unmap();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTerrainTile::Map(const SGPath& path)
+{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  file = CreateFileW(path.wstr().c_str(), GENERIC_READ, FILE_SHARE_READ,
+                     nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    throw JSBBaseException("Could not open the terrain file "
+                           + path.utf8Str());
+
+  LARGE_INTEGER fileSize;
+  GetFileSizeEx(file, &fileSize);
+  size = (size_t)fileSize.QuadPart;
+  mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping)
+    data = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+  if (!data) {
+    if (mapping) CloseHandle(mapping);
+    CloseHandle(file);
+    throw JSBBaseException("Could not map the terrain file " + path.utf8Str());
+  }
+#else
+  int fd = open(path.utf8Str().c_str(), O_RDONLY);
+  if (fd < 0)
+    throw JSBBaseException("Could not open the terrain file "
+                           + path.utf8Str());
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    size = st.st_size;
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED) data = (const unsigned char*)addr;
+  }
+  close(fd); // The mapping remains valid after the file is closed.
+
+  if (!data)
+    throw JSBBaseException("Could not map the terrain file " + path.utf8Str());
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTerrainTile::Unmap(void)
+{
+  if (!data) return;
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  UnmapViewOfFile(data);
+  CloseHandle(mapping);
+  CloseHandle(file);
+#else
+  munmap((void*)data, size);
+#endif
+  data = nullptr;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTerrainTile::Sample(unsigned int row, unsigned int col) const
+{
+  size_t index = size_t(row) * ncols + col;
+
+  if (format == eSRTM) {
+    const unsigned char* p = grid + 2*index;
+    short h = short(p[0] << 8 | p[1]);
+    return h == SRTMVoid ? NAN : h;
+  }
+
+  uint32_t bits = ReadLE32(grid + 4*index);
+  float h;
+  memcpy(&h, &bits, sizeof(h));
+  return h;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTerrainTile::Interpolate(double lat, double lon, double& h,
+                                double& dhdlat, double& dhdlon) const
+{
+  double x = (lon - west) / dlon;
+  double y = (north - lat) / dlat;
+  unsigned int col = min((unsigned int)x, ncols-2);
+  unsigned int row = min((unsigned int)y, nrows-2);
+  double fx = x - col;
+  double fy = y - row;
+
+  double h00 = Sample(row, col);
+  double h01 = Sample(row, col+1);
+  double h10 = Sample(row+1, col);
+  double h11 = Sample(row+1, col+1);
+
+  // Voids are replaced by the mean of the valid neighbours.
+  if (std::isnan(h00) || std::isnan(h01) || std::isnan(h10) || std::isnan(h11)) {
+    double sum = 0.0;
+    unsigned int n = 0;
+    for (double hv: {h00, h01, h10, h11}) {
+      if (!std::isnan(hv)) {
+        sum += hv;
+        n++;
+      }
+    }
+    if (n == 0) return false;
+
+    double mean = sum / n;
+    if (std::isnan(h00)) h00 = mean;
+    if (std::isnan(h01)) h01 = mean;
+    if (std::isnan(h10)) h10 = mean;
+    if (std::isnan(h11)) h11 = mean;
+  }
+
+  double hn = h00 + fx*(h01 - h00); // North edge of the cell
+  double hs = h10 + fx*(h11 - h10); // South edge of the cell
+  h = hn + fy*(hs - hn);
+  dhdlon = ((1.0-fy)*(h01 - h00) + fy*(h11 - h10)) / dlon;
+  dhdlat = (hn - hs) / dlat;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTerrainTile::GetMaxElevation(double s, double n, double w, double e,
+                                    double& hmax) const
+{
+  s = max(s, south);
+  n = min(n, north);
+  w = max(w, west);
+  e = min(e, east);
+  if (s > n || w > e) return true;
+
+  // The bilinear interpolation never exceeds the grid points at the corners of
+  // the cells so the grid points of the cells that overlap the box are enough.
+  unsigned int col0 = min((unsigned int)((w - west) / dlon), ncols-1);
+  unsigned int col1 = min((unsigned int)ceil((e - west) / dlon), ncols-1);
+  unsigned int row0 = min((unsigned int)((north - n) / dlat), nrows-1);
+  unsigned int row1 = min((unsigned int)ceil((north - s) / dlat), nrows-1);
+
+  if (size_t(row1 - row0 + 1) * (col1 - col0 + 1) > 4096) return false;
+
+  for (unsigned int row=row0; row<=row1; row++) {
+    for (unsigned int col=col0; col<=col1; col++) {
+      double h = Sample(row, col);
+      if (std::isnan(h)) return false;
+      hmax = max(hmax, h);
+    }
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTerrain::FGTerrain(const SGPath& path, unsigned int maxTiles)
+  : MaxTiles(max(maxTiles, 1u)), TileLoads(0)
+{
+  if (path.isDir()) {
+    Directory = path;
+    return;
+  }
+
+  string ext = path.extension();
+  for (auto& c: ext) c = tolower(c);
+
+  if (ext == "hgt")
+    SingleTile = make_shared<FGTerrainTile>(path, FGTerrainTile::eSRTM);
+  else
+    SingleTile = make_shared<FGTerrainTile>(path, FGTerrainTile::eGrid);
+
+  TileLoads = 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTerrain::~FGTerrain()
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGTerrain::GetNumCachedTiles(void) const
+{
+  lock_guard<mutex> lock(CacheMutex);
+  return Cache.size();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTerrain::Tile_ptr FGTerrain::FindTile(double lat, double lon) const
+{
+  if (SingleTile)
+    return SingleTile->Contains(lat, lon) ? SingleTile : nullptr;
+
+  int ilat = (int)floor(lat);
+  int ilon = (int)floor(lon);
+  if (ilat == 90) ilat = 89; // The north pole belongs to the last row of tiles
+  int cell = CellIndex(ilat, ilon);
+
+  lock_guard<mutex> lock(CacheMutex);
+
+  auto it = Cache.find(cell);
+  if (it != Cache.end()) {
+    LRU.splice(LRU.begin(), LRU, it->second.second);
+    return it->second.first;
+  }
+
+  if (Missing.count(cell)) return nullptr;
+
+  SGPath tilePath = Directory/SRTMName(ilat, ilon);
+  if (!tilePath.exists()) {
+    Missing.insert(cell);
+    return nullptr;
+  }
+
+  Tile_ptr tile;
+  try {
+    tile = make_shared<FGTerrainTile>(tilePath, FGTerrainTile::eSRTM);
+  } catch (const JSBBaseException& e) {
+    cerr << e.what() << endl;
+    Missing.insert(cell);
+    return nullptr;
+  }
+  TileLoads++;
+
+  // The tiles evicted from the cache remain mapped as long as a ground
+  // callback is using them.
+  if (Cache.size() >= MaxTiles) {
+    Cache.erase(LRU.back());
+    LRU.pop_back();
+  }
+
+  LRU.push_front(cell);
+  Cache[cell] = make_pair(tile, LRU.begin());
+
+  return tile;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTerrain::GetElevation(double lat, double lon, double& h,
+                             double& dhdlat, double& dhdlon,
+                             shared_ptr<const FGTerrainTile>& hint) const
+{
+  double latDeg = lat * radtodeg;
+  double lonDeg = lon * radtodeg;
+
+  if (lonDeg >= 180.0) lonDeg -= 360.0;
+  else if (lonDeg < -180.0) lonDeg += 360.0;
+
+  if (!hint || !hint->Contains(latDeg, lonDeg)) {
+    hint = FindTile(latDeg, lonDeg);
+    if (!hint) return false;
+  }
+
+  double hm, dhdlatm, dhdlonm;
+  if (!hint->Interpolate(latDeg, lonDeg, hm, dhdlatm, dhdlonm)) return false;
+
+  const double scale = radtodeg / fttom;
+  h = hm / fttom;
+  dhdlat = dhdlatm * scale;
+  dhdlon = dhdlonm * scale;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTerrain::GetMaxElevation(double lat, double lon, double dlat,
+                                double dlon, double hdefault,
+                                double& hmax) const
+{
+  double latDeg = lat * radtodeg;
+  double lonDeg = lon * radtodeg;
+  double dlatDeg = dlat * radtodeg;
+  double dlonDeg = dlon * radtodeg;
+
+  if (lonDeg >= 180.0) lonDeg -= 360.0;
+  else if (lonDeg < -180.0) lonDeg += 360.0;
+
+  double south = latDeg - dlatDeg, north = latDeg + dlatDeg;
+  double west = lonDeg - dlonDeg, east = lonDeg + dlonDeg;
+
+  // Boxes that wrap around the poles or the antimeridian are not supported.
+  // Boxes smaller than a SRTM tile overlap at most the 4 tiles that contain
+  // their corners.
+  if (dlatDeg > 0.5 || dlonDeg > 0.5 || south < -90.0 || north > 90.0
+      || west < -180.0 || east >= 180.0)
+    return false;
+
+  double hm = -HUGE_VAL;
+  bool gaps = false;
+
+  if (SingleTile) {
+    if (!SingleTile->Contains(south, west) || !SingleTile->Contains(north, east))
+      gaps = true;
+    if (!SingleTile->GetMaxElevation(south, north, west, east, hm))
+      return false;
+  }
+  else {
+    Tile_ptr tiles[4];
+    unsigned int n = 0;
+    for (double clat: {south, north}) {
+      for (double clon: {west, east}) {
+        Tile_ptr tile = FindTile(clat, clon);
+        if (!tile) {
+          gaps = true;
+          continue;
+        }
+        if (find(tiles, tiles+n, tile) != tiles+n) continue;
+        tiles[n++] = tile;
+        if (!tile->GetMaxElevation(south, north, west, east, hm)) return false;
+      }
+    }
+  }
+
+  // The parts of the box that are not covered by the terrain data are at the
+  // default elevation.
+  hmax = hm / fttom;
+  if (gaps) hmax = max(hmax, hdefault);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTerrainGroundCallback::GetAGLevel(double t, const FGLocation& loc,
+                                           FGLocation& contact,
+                                           FGColumnVector3& normal,
+                                           FGColumnVector3& vel,
+                                           FGColumnVector3& angularVel) const
+{
+  vel.InitMatrix();
+  angularVel.InitMatrix();
+  FGLocation l = loc;
+  l.SetEllipse(a, b);
+  double latitude = l.GetGeodLatitudeRad();
+  double longitude = l.GetLongitude();
+  double sinLat = sin(latitude), cosLat = cos(latitude);
+  double sinLon = sin(longitude), cosLon = cos(longitude);
+  double h = mTerrainElevation, dhdlat = 0.0, dhdlon = 0.0;
+
+  Terrain->GetElevation(latitude, longitude, h, dhdlat, dhdlon, LastTile);
+
+  FGColumnVector3 up(cosLat*cosLon, cosLat*sinLon, sinLat);
+  normal = up;
+
+  if (dhdlat != 0.0 || dhdlon != 0.0) {
+    // Meridian (M) and prime vertical (N) radii of curvature
+    double e2 = 1.0 - b*b/(a*a);
+    double w = sqrt(1.0 - e2*sinLat*sinLat);
+    double N = a / w;
+    double M = N * (1.0 - e2) / (w*w);
+    FGColumnVector3 north(-sinLat*cosLon, -sinLat*sinLon, cosLat);
+    FGColumnVector3 east(-sinLon, cosLon, 0.0);
+
+    normal -= dhdlat / (M + h) * north;
+    if (cosLat > 1E-9) normal -= dhdlon / ((N + h) * cosLat) * east;
+    normal.Normalize();
+  }
+
+  contact.SetEllipse(a, b);
+  contact.SetPositionGeodetic(longitude, latitude, h);
+  return l.GetGeodAltitude() - h;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTerrainGroundCallback::GetAGLevels(double t,
+                                      const vector<FGLocation>& locations,
+                                      vector<ContactPoint>& contacts) const
+{
+  contacts.resize(locations.size());
+
+  // The contact points of a vehicle are usually on the same tile so the tile
+  // hint saves the cache lookups after the first query.
+  for (size_t i=0; i<locations.size(); i++) {
+    ContactPoint& c = contacts[i];
+    c.agl = FGTerrainGroundCallback::GetAGLevel(t, locations[i], c.contact,
+                                                c.normal, c.velocity,
+                                                c.ang_velocity);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTerrainGroundCallback::GetMaxTerrainElevation(double t,
+                                                     const FGLocation& loc,
+                                                     double radius,
+                                                     double& hmax) const
+{
+  FGLocation l = loc;
+  l.SetEllipse(a, b);
+  double latitude = l.GetGeodLatitudeRad();
+  double cosLat = cos(latitude);
+
+  // b^2/a is the smallest radius of curvature of the ellipsoid so the box
+  // computed with it contains the disc of the given radius.
+  double rmin = b*b/a;
+  double dlat = radius / rmin;
+  if (cosLat < 1E-3) return false;
+  double dlon = dlat / cosLat;
+
+  return Terrain->GetMaxElevation(latitude, l.GetLongitude(), dlat, dlon,
+                                  mTerrainElevation, hmax);
+}
+
+} // namespace JSBSim
@@ -0,0 +1,218 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGTerrainGroundCallback.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTERRAINGROUNDCALLBACK_H
+#define FGTERRAINGROUNDCALLBACK_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "FGGroundCallback.h"
+#include "FGJSBBase.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGTerrainTile;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Digital elevation model (DEM) made of memory mapped elevation grids.
+
+    The terrain is read from one of the following sources:
+    - a SRTM tile (e.g. <tt>N37W123.hgt</tt>): a square grid of 1201x1201 or
+      3601x3601 big endian 16 bits integers covering one degree of latitude and
+      longitude. The location of the tile is given by its file name and the
+      voids (-32768) are ignored.
+    - a directory of SRTM tiles. The tiles are opened on demand when the
+      aircraft flies over them and an LRU cache keeps the most recently used
+      tiles mapped in memory.
+    - a binary grid file (extension <tt>.dem</tt>) made of a 48 bytes header
+      followed by the elevations in meters stored as little endian 32 bits
+      floats, row by row starting from the north west corner. The header
+      contains the magic string <tt>JSBDEM01</tt>, the number of columns and
+      rows (little endian 32 bits unsigned integers), then the longitude of the
+      west edge, the latitude of the north edge, the longitude spacing and the
+      latitude spacing in degrees (little endian 64 bits floats). NaN
+      elevations are voids.
+
+    The files are never loaded in memory: they are memory mapped and the
+    operating system pages in the parts of the grids that are actually used.
+    The terrain is immutable once built so a single instance can be shared
+    between several FGFDMExec instances, including when they run in different
+    threads.
+
+    The elevations are interpolated bilinearly between the grid points.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGTerrain : public FGJSBBase
+{
+public:
+  /** Constructor.
+      @param path a SRTM tile, a directory of SRTM tiles or a binary grid file.
+      @param maxTiles the maximum number of SRTM tiles kept mapped in memory
+                      when path is a directory.
+      Throws a JSBBaseException if the terrain can not be read. */
+  explicit FGTerrain(const SGPath& path, unsigned int maxTiles=16);
+  ~FGTerrain();
+
+  /** Interpolates the terrain elevation.
+      @param lat geodetic latitude in radians
+      @param lon longitude in radians
+      @param h returns the elevation in feet
+      @param dhdlat returns the derivative of the elevation wrt the latitude
+                    (feet per radian)
+      @param dhdlon returns the derivative of the elevation wrt the longitude
+                    (feet per radian)
+      @param hint the tile used by the previous call. It is checked first and
+                  updated with the tile used by this call. Caching the hint
+                  avoids locking the tile cache as long as the location remains
+                  on the same tile.
+      @return false if the location is not covered by the terrain data, in
+              which case h, dhdlat and dhdlon are left unchanged. */
+  bool GetElevation(double lat, double lon, double& h, double& dhdlat,
+                    double& dhdlon,
+                    std::shared_ptr<const FGTerrainTile>& hint) const;
+
+  /** Computes an upper bound of the elevation within a box.
+      @param lat geodetic latitude of the center of the box in radians
+      @param lon longitude of the center of the box in radians
+      @param dlat half height of the box in radians
+      @param dlon half width of the box in radians
+      @param hdefault the elevation in feet of the parts of the box that are
+                      not covered by the terrain data
+      @param hmax returns the maximum elevation in feet
+      @return false if the elevation can not be bounded: the box is too large
+              or contains voids. */
+  bool GetMaxElevation(double lat, double lon, double dlat, double dlon,
+                       double hdefault, double& hmax) const;
+
+  /// Number of tiles that have been mapped in memory since the construction.
+  unsigned long GetNumTileLoads(void) const { return TileLoads; }
+  /// Number of tiles currently held by the LRU cache.
+  size_t GetNumCachedTiles(void) const;
+
+private:
+  typedef std::shared_ptr<const FGTerrainTile> Tile_ptr;
+
+  SGPath Directory;
+  unsigned int MaxTiles;
+  Tile_ptr SingleTile;
+
+  mutable std::mutex CacheMutex;
+  mutable std::list<int> LRU;  // Most recently used cells first
+  mutable std::unordered_map<int, std::pair<Tile_ptr, std::list<int>::iterator>> Cache;
+  mutable std::unordered_set<int> Missing;
+  mutable std::atomic<unsigned long> TileLoads;
+
+  Tile_ptr FindTile(double lat, double lon) const;
+};
+
+/** A ground callback that gets the terrain elevation from a FGTerrain.
+    The ground normal is computed from the slope of the terrain. Outside of the
+    area covered by the terrain data, the ground callback behaves like
+    FGDefaultGroundCallback: the terrain elevation is the value set by
+    SetTerrainElevation().
+
+    The terrain data is shared, so each FGFDMExec needs its own callback:
+    @code
+    auto terrain = std::make_shared<FGTerrain>(SGPath("srtm"));
+    FGInertial* inertial = fdmex->GetInertial();
+    inertial->SetGroundCallback(new FGTerrainGroundCallback(terrain,
+                                                   inertial->GetSemimajor(),
+                                                   inertial->GetSemiminor()));
+    @endcode
+ */
+class FGTerrainGroundCallback : public FGGroundCallback
+{
+public:
+  FGTerrainGroundCallback(std::shared_ptr<const FGTerrain> terrain,
+                          double semiMajor, double semiMinor)
+    : Terrain(terrain), a(semiMajor), b(semiMinor) {}
+
+  using FGGroundCallback::GetAGLevel;
+  double GetAGLevel(double t, const FGLocation& location,
+                    FGLocation& contact,
+                    FGColumnVector3& normal, FGColumnVector3& v,
+                    FGColumnVector3& w) const override;
+
+  using FGGroundCallback::GetAGLevels;
+  void GetAGLevels(double t, const std::vector<FGLocation>& locations,
+                   std::vector<ContactPoint>& contacts) const override;
+
+  using FGGroundCallback::GetMaxTerrainElevation;
+  bool GetMaxTerrainElevation(double t, const FGLocation& location,
+                              double radius, double& hmax) const override;
+
+  /// The copy shares the terrain data.
+  FGGroundCallback* Clone(void) const override {
+    if (typeid(*this) != typeid(FGTerrainGroundCallback)) return nullptr;
+    return new FGTerrainGroundCallback(*this);
+  }
+
+  void SetTerrainElevation(double h) override
+  { mTerrainElevation = h; }
+
+  void SetEllipse(double semimajor, double semiminor) override
+  { a = semimajor; b = semiminor; }
+
+  std::shared_ptr<const FGTerrain> GetTerrain(void) const { return Terrain; }
+
+private:
+  std::shared_ptr<const FGTerrain> Terrain;
+  mutable std::shared_ptr<const FGTerrainTile> LastTile;
+  double a, b;
+  double mTerrainElevation = 0.0;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -29,6 +29,9 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <sstream>  // for assembling the error messages / what of exceptions.
+#include <cerrno>
+#include <cstring>
+#include <mutex>
 #include <stdexcept>  // using domain_error, invalid_argument, and length_error.
 #include "FGXMLElement.h"
 #include "FGJSBBase.h"
@@ -41,8 +44,9 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
-bool Element::converterIsInitialized = false;
+atomic<bool> Element::converterIsInitialized(false);
 map <string, map <string, double> > Element::convert;
+static mutex converterMutex;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
@@ -55,8 +59,12 @@ Element::Element(const string& nm)
   element_index = 0;
   line_number = -1;
 
+  // The elements can be created by several threads at once (see
+  // FGXMLFileRead::Preload) so the conversion table is filled under a lock.
   if (!converterIsInitialized) {
-    converterIsInitialized = true;
+    lock_guard<mutex> lock(converterMutex);
+    if (converterIsInitialized) return;
+
     // convert ["from"]["to"] = factor, so: from * factor = to
     // Length
     convert["M"]["FT"] = 3.2808399;
@@ -248,6 +256,8 @@ Element::Element(const string& nm)
     convert["VOLTS"]["VOLTS"] = 1.0;
     convert["OHMS"]["OHMS"] = 1.0;
     convert["AMPERES"]["AMPERES"] = 1.0;
+
+    converterIsInitialized = true;
   }
 }
 
@@ -336,14 +346,47 @@ Element* Element::GetNextElement(void)
 
 string Element::GetDataLine(unsigned int i)
 {
+  if (numeric_data) {
+    if (i >= numeric_data->line_ends.size()) return string("");
+
+    ostringstream line;
+    line.precision(17);
+    unsigned int start = i > 0 ? numeric_data->line_ends[i-1] : 0;
+    for (unsigned int j=start; j<numeric_data->line_ends[i]; ++j) {
+      if (j > start) line << " ";
+      line << numeric_data->values[j];
+    }
+    return line.str();
+  }
+
   if (!data_lines.empty()) return data_lines[i];
   else return string("");
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+unsigned int Element::GetNumDataLines(void) const
+{
+  if (numeric_data) return (unsigned int)numeric_data->line_ends.size();
+  return (unsigned int)data_lines.size();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int Element::GetNumDataValues(unsigned int i) const
+{
+  if (!numeric_data || i >= numeric_data->line_ends.size()) return 0;
+  unsigned int start = i > 0 ? numeric_data->line_ends[i-1] : 0;
+  return numeric_data->line_ends[i] - start;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double Element::GetDataAsNumber(void)
 {
+  if (GetNumDataValues(0) == 1 && GetNumDataLines() == 1)
+    return numeric_data->values[0];
+
   if (data_lines.size() == 1) {
     double number=0;
     if (is_number(trim(data_lines[0])))
@@ -710,9 +753,9 @@ void Element::Print(unsigned int level)
     cout << "  " << it->first << " = " << it->second;
 
   cout << endl;
-  for (i=0; i<data_lines.size(); i++) {
+  for (i=0; i<GetNumDataLines(); i++) {
     for (spaces=0; spaces<=level; spaces++) cout << " "; // format output
-    cout << data_lines[i] << endl;
+    cout << GetDataLine(i) << endl;
   }
   for (i=0; i<children.size(); i++) {
     children[i]->Print(level);
@@ -739,6 +782,72 @@ void Element::AddData(string d)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+// Splits the data in lines and converts the lines to numbers. Returns false if
+// anything else than numbers separated by blanks is found.
+static bool ParseNumbers(const char* p, vector<double>& values,
+                         vector<unsigned int>& line_ends)
+{
+  while (*p) {
+    unsigned int count = 0;
+
+    // Read the numbers until the end of the line.
+    while (*p && *p != '\n') {
+      if (*p == ' ' || *p == '\t' || (*p == '\r' && (p[1] == '\n' || !p[1]))) {
+        ++p;
+        continue;
+      }
+
+      // The token must only contain the characters that FGTable accepts and
+      // must be converted in its entirety.
+      size_t length = strspn(p, "0123456789.-+eE");
+      if (length == 0) return false;
+      char* end;
+      errno = 0;
+      double value = strtod(p, &end);
+      if (end != p + length || errno == ERANGE) return false;
+
+      values.push_back(value);
+      ++count;
+      p = end;
+    }
+
+    // Blank lines are skipped just like AddData() never gets them.
+    if (count > 0) line_ends.push_back((unsigned int)values.size());
+    if (*p) ++p;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool Element::AddNumericData(const string& d)
+{
+  // The numbers cannot be appended to lines of text.
+  if (!data_lines.empty()) return false;
+
+  auto data = make_shared<NumericData>();
+  if (numeric_data) *data = *numeric_data;
+
+  if (!ParseNumbers(d.c_str(), data->values, data->line_ends)) {
+    // Numbers already stored are converted back to text so that the text
+    // that follows can be appended to them.
+    if (numeric_data) {
+      vector<string> lines;
+      for (unsigned int i=0; i<GetNumDataLines(); ++i)
+        lines.push_back(GetDataLine(i));
+      numeric_data.reset();
+      data_lines = lines;
+    }
+    return false;
+  }
+
+  if (!data->line_ends.empty()) numeric_data = data;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string Element::ReadFrom(void) const
 {
   ostringstream message;
@@ -769,4 +878,26 @@ void Element::MergeAttributes(Element* el)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr Element::Clone(void) const
+{
+  Element_ptr copy = new Element(name);
+
+  copy->attributes = attributes;
+  copy->data_lines = data_lines;
+  copy->numeric_data = numeric_data;
+  copy->file_name = file_name;
+  copy->line_number = line_number;
+  copy->children.reserve(children.size());
+
+  for (auto& child: children) {
+    Element_ptr child_copy = child->Clone();
+    child_copy->parent = copy;
+    copy->children.push_back(child_copy);
+  }
+
+  return copy;
+}
+
 } // end namespace JSBSim
@@ -34,9 +34,11 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <atomic>
 #include <string>
 #include <map>
 #include <vector>
+#include <memory>
 
 #include "simgear/structure/SGSharedPtr.hxx"
 #include "math/FGColumnVector3.h"
@@ -186,7 +188,24 @@ public:
   std::string GetDataLine(unsigned int i=0);
 
   /// Returns the number of lines of data stored
-  unsigned int GetNumDataLines(void) {return (unsigned int)data_lines.size();}
+  unsigned int GetNumDataLines(void) const;
+
+  /** Determines if the data of the element is stored as numbers.
+      The data of the <tableData> elements is converted to numbers while the
+      file is parsed rather than stored as lines of text (see AddNumericData).
+      In that case GetDataLine() rebuilds the lines of text on demand.
+      @return true if the data is available from GetNumericData(). */
+  bool HasNumericData(void) const {return numeric_data != nullptr;}
+
+  /** Returns the numbers owned by the element, line after line.
+      Must only be called if HasNumericData() returns true. */
+  const std::vector<double>& GetNumericData(void) const
+  { return numeric_data->values; }
+
+  /** Returns the number of numbers in a line of numeric data.
+      @param i the index of the data line
+      @return the number of values in the line, or 0 if there is no such line.*/
+  unsigned int GetNumDataValues(unsigned int i) const;
 
   /// Returns the number of child elements for this element.
   unsigned int GetNumElements(void) {return (unsigned int)children.size();}
@@ -353,6 +372,15 @@ public:
   *   @param d the data to store. */
   void AddData(std::string d);
 
+  /** Stores data belonging to this element as numbers.
+      The data is split in lines and the lines in numbers separated by blanks.
+      The data is rejected if any of the lines contain anything else than
+      numbers, in which case it must be stored with AddData() so that the
+      offending line can be reported by the code that uses the element.
+  *   @param d the data to store.
+  *   @return true if the data has been stored. */
+  bool AddNumericData(const std::string& d);
+
   /** Prints the element.
   *   Prints this element and calls the Print routine for child elements.
   *   @param d The tab level. A level corresponds to a single space. */
@@ -384,10 +412,24 @@ public:
    */
   void MergeAttributes(Element* el);
 
+  /** Returns a deep copy of the element and of its children. The copy has no
+   *  parent and the iterators of its elements are reset.
+   */
+  Element_ptr Clone(void) const;
+
 private:
+  friend class FGXMLFileRead;  // Binary images of the documents
+
   std::string name;
   std::map <std::string, std::string> attributes;
   std::vector <std::string> data_lines;
+  // The numeric data is never modified once parsed so it is shared by the
+  // copies of the element made by Clone().
+  struct NumericData {
+    std::vector<double> values;
+    std::vector<unsigned int> line_ends; // Index of the end of each line.
+  };
+  std::shared_ptr<const NumericData> numeric_data;
   std::vector <Element_ptr> children;
   Element *parent;
   unsigned int element_index;
@@ -395,7 +437,7 @@ private:
   int line_number;
   typedef std::map <std::string, std::map <std::string, double> > tMapConvert;
   static tMapConvert convert;
-  static bool converterIsInitialized;
+  static std::atomic<bool> converterIsInitialized;
 };
 
 } // namespace JSBSim
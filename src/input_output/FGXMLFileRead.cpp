@@ -0,0 +1,575 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGXMLFileRead.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Cache of the parsed XML documents
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+The XML documents are parsed once per process and kept in a cache shared by all
+the FGXMLFileRead instances.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+#include "FGXMLFileRead.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+GLOBAL DATA
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+struct CachedDocument {
+  uint64_t size;
+  uint64_t hash;
+  Element_ptr document;  // Never modified once cached
+  // Modification time of the file when its content was last hashed. The
+  // content is not read again as long as the modification time and the size
+  // of the file are unchanged. Null if the file could have been modified
+  // within the same second (see Stamp()).
+  time_t mtime = 0;
+  uint64_t lastUse = 0;
+  // Set by Preload() which has just read the file: the next load uses the
+  // document without reading the file a second time.
+  bool preloaded = false;
+};
+
+// The reference counters of the elements are not atomic so the cached
+// documents must only be accessed while the mutex is locked.
+mutex CacheMutex;
+unordered_map<string, CachedDocument> Cache;
+FGXMLFileRead::CacheStatistics Statistics;
+size_t Capacity = 512;
+uint64_t UseCounter = 0;
+
+// Images that have already been read, with their modification time and size.
+unordered_map<string, pair<time_t, size_t>> Images;
+
+// The images start with a magic string followed by the format version which
+// must be incremented each time the format is modified.
+const char ImageMagic[8] = {'J', 'S', 'B', 'I', 'M', 'G', '\0', '\0'};
+const uint32_t ImageVersion = 3;
+
+// FNV-1a hash. Unlike std::hash, it does not depend on the compiler so the
+// hashes stored in the images are portable.
+uint64_t Hash(const string& data)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c: data) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+// The integers are stored in little endian order whatever the platform.
+void Write(ostream& out, uint64_t value, int bytes)
+{
+  for (int i=0; i<bytes; i++) out.put(char((value >> (8*i)) & 0xff));
+}
+
+void Write(ostream& out, const string& str)
+{
+  Write(out, str.size(), 4);
+  out.write(str.data(), str.size());
+}
+
+// Checks that at least n bytes are left in the stream. The images are read
+// from memory so that the sizes read from the image can be checked against
+// the size of the data that remains before anything is allocated.
+bool Available(istream& in, uint64_t n)
+{
+  streamsize avail = in.rdbuf()->in_avail();
+  return avail >= 0 && n <= uint64_t(avail);
+}
+
+bool Read(istream& in, uint64_t& value, int bytes)
+{
+  unsigned char buffer[8];
+  if (!in.read(reinterpret_cast<char*>(buffer), bytes)) return false;
+  value = 0;
+  for (int i=bytes-1; i>=0; i--) value = (value << 8) | buffer[i];
+  return true;
+}
+
+bool Read(istream& in, uint32_t& value)
+{
+  uint64_t v;
+  if (!Read(in, v, 4)) return false;
+  value = uint32_t(v);
+  return true;
+}
+
+bool Read(istream& in, string& str)
+{
+  uint32_t size;
+  if (!Read(in, size) || !Available(in, size)) return false;
+  str.resize(size);
+  return size == 0 || in.read(&str[0], size);
+}
+
+// Returns the modification time of a file if it can be trusted to detect the
+// modifications of the file, 0 otherwise. The modification times have a
+// resolution of one second so a file modified in the same second as it was
+// read could be modified again without changing its modification time.
+time_t Stamp(const SGPath& filename, time_t readTime)
+{
+  time_t mtime = filename.modTime();
+  return mtime < readTime ? mtime : 0;
+}
+
+// Removes the least recently used documents until the cache size is within
+// its capacity. The mutex must be locked.
+void Evict(void)
+{
+  while (Cache.size() > Capacity) {
+    auto lru = Cache.begin();
+    for (auto it = Cache.begin(); it != Cache.end(); ++it)
+      if (it->second.lastUse < lru->second.lastUse) lru = it;
+    Cache.erase(lru);
+  }
+}
+
+// Returns the key of a file in the cache: its canonical path.
+string CacheKey(const SGPath& filename)
+{
+  SGPath path(filename);
+  if (path.extension().empty()) path.concat(".xml");
+  return path.realpath().utf8Str();
+}
+
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+Element* FGXMLFileRead::LoadXMLDocument(const SGPath& XML_filename,
+                                        bool verbose)
+{
+  return ReadDocument(XML_filename, verbose, true);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element* FGXMLFileRead::ReadDocument(const SGPath& XML_filename, bool verbose,
+                                     bool copyCached)
+{
+  sg_ifstream infile;
+  SGPath filename(XML_filename);
+
+  if (!filename.isNull()) {
+    if (filename.extension().empty())
+      filename.concat(".xml");
+
+    infile.open(filename);
+    if ( !infile.is_open()) {
+      if (verbose) cerr << "Could not open file: " << filename << endl;
+      return 0L;
+    }
+  } else {
+    cerr << "No filename given." << endl;
+    return 0L;
+  }
+
+  string key = CacheKey(filename);
+  time_t mtime = filename.modTime();
+
+  // The models modify the documents they read so each load gets its own copy
+  // of the cached document.
+  auto Hit = [this, copyCached](CachedDocument& doc) -> Element* {
+    doc.lastUse = ++UseCounter;
+    doc.preloaded = !copyCached;
+    if (!copyCached) return 0L;
+    Statistics.hits++;
+    document = doc.document->Clone();
+    return document;
+  };
+
+  // Files that have just been preloaded or whose modification time and size
+  // are unchanged are not read.
+  {
+    lock_guard<mutex> lock(CacheMutex);
+    auto it = Cache.find(key);
+    if (it != Cache.end()
+        && ((it->second.preloaded && copyCached)
+            || (it->second.mtime != 0 && it->second.mtime == mtime
+                && it->second.size == uint64_t(filename.sizeInBytes()))))
+      return Hit(it->second);
+  }
+
+  time_t readTime = time(nullptr);
+  ostringstream buffer;
+  buffer << infile.rdbuf();
+  infile.close();
+  string content = buffer.str();
+
+  uint64_t hash = Hash(content);
+
+  {
+    lock_guard<mutex> lock(CacheMutex);
+    Statistics.reads++;
+    auto it = Cache.find(key);
+    if (it != Cache.end() && it->second.size == content.size()
+        && it->second.hash == hash) {
+      it->second.mtime = Stamp(filename, readTime);
+      return Hit(it->second);
+    }
+  }
+
+  istringstream input(content);
+  readXML(input, file_parser, filename.utf8Str());
+  Element* parsed = file_parser.GetDocument();
+
+  if (parsed) {
+    lock_guard<mutex> lock(CacheMutex);
+    Statistics.misses++;
+    if (Capacity > 0) {
+      CachedDocument& doc = Cache[key];
+      doc = {content.size(), hash, parsed->Clone(), Stamp(filename, readTime),
+             ++UseCounter, !copyCached};
+      Evict();
+    }
+  }
+
+  return parsed;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLFileRead::Preload(const vector<SGPath>& filenames,
+                            unsigned int threads)
+{
+  // The same file can be referenced several times (engines for instance).
+  vector<SGPath> files;
+  for (auto& filename: filenames) {
+    if (find(files.begin(), files.end(), filename) == files.end())
+      files.push_back(filename);
+  }
+
+  if (threads == 0) threads = thread::hardware_concurrency();
+  threads = max(1U, min(threads, (unsigned int)files.size()));
+
+  // The parsing errors must not escape the threads: the files that can not be
+  // parsed are skipped so that the errors are reported as usual when the
+  // models load them.
+  atomic<size_t> next(0);
+  auto parse = [&files, &next]() {
+    for (size_t i = next++; i < files.size(); i = next++) {
+      FGXMLFileRead reader;
+      try {
+        reader.ReadDocument(files[i], false, false);
+      } catch (...) {}
+    }
+  };
+
+  vector<thread> pool;
+  for (unsigned int i=1; i<threads; ++i)
+    pool.emplace_back(parse);
+  parse();
+  for (auto& worker: pool) worker.join();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGXMLFileRead::CacheStatistics FGXMLFileRead::GetCacheStatistics(void)
+{
+  lock_guard<mutex> lock(CacheMutex);
+  CacheStatistics stats = Statistics;
+  stats.documents = Cache.size();
+  return stats;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLFileRead::ClearCache(void)
+{
+  lock_guard<mutex> lock(CacheMutex);
+  Cache.clear();
+  Images.clear();
+  Statistics = CacheStatistics();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLFileRead::SetCacheCapacity(size_t documents)
+{
+  lock_guard<mutex> lock(CacheMutex);
+  Capacity = documents;
+  Evict();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLFileRead::WriteElement(ostream& out, const Element* el)
+{
+  Write(out, el->name);
+  Write(out, uint32_t(el->line_number), 4);
+
+  Write(out, el->attributes.size(), 4);
+  for (auto& attribute: el->attributes) {
+    Write(out, attribute.first);
+    Write(out, attribute.second);
+  }
+
+  Write(out, el->data_lines.size(), 4);
+  for (auto& line: el->data_lines)
+    Write(out, line);
+
+  if (el->numeric_data) {
+    Write(out, el->numeric_data->line_ends.size(), 4);
+    for (auto end: el->numeric_data->line_ends)
+      Write(out, end, 4);
+    for (double value: el->numeric_data->values) {
+      uint64_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+      Write(out, bits, 8);
+    }
+  } else
+    Write(out, 0, 4);
+
+  Write(out, el->children.size(), 4);
+  for (auto& child: el->children)
+    WriteElement(out, child);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGXMLFileRead::ReadElement(istream& in, const string& file_name,
+                                       int depth)
+{
+  string name;
+  uint32_t line_number, count;
+
+  // Protect the stack against corrupted images.
+  if (depth > 1000) return nullptr;
+
+  if (!Read(in, name) || !Read(in, line_number)) return nullptr;
+
+  // All the elements of a document come from the same file.
+  Element_ptr el = new Element(name);
+  el->file_name = file_name;
+  el->line_number = int(line_number);
+
+  // The counts are checked against the minimum size of the items that follow
+  // before any memory is allocated for them.
+  if (!Read(in, count) || !Available(in, 8*uint64_t(count))) return nullptr;
+  for (uint32_t i=0; i<count; i++) {
+    string key, value;
+    if (!Read(in, key) || !Read(in, value)) return nullptr;
+    el->attributes[key] = value;
+  }
+
+  if (!Read(in, count) || !Available(in, 4*uint64_t(count))) return nullptr;
+  el->data_lines.resize(count);
+  for (auto& line: el->data_lines)
+    if (!Read(in, line)) return nullptr;
+
+  if (!Read(in, count) || !Available(in, 4*uint64_t(count))) return nullptr;
+  if (count > 0) {
+    auto data = make_shared<Element::NumericData>();
+    uint32_t previous = 0;
+    data->line_ends.resize(count);
+    for (auto& end: data->line_ends) {
+      // Each line contains at least one number.
+      if (!Read(in, end) || end <= previous) return nullptr;
+      previous = end;
+    }
+    if (!Available(in, 8*uint64_t(data->line_ends.back()))) return nullptr;
+    data->values.resize(data->line_ends.back());
+    for (double& value: data->values) {
+      uint64_t bits;
+      if (!Read(in, bits, 8)) return nullptr;
+      memcpy(&value, &bits, sizeof(value));
+    }
+    el->numeric_data = data;
+  }
+
+  if (!Read(in, count)) return nullptr;
+  for (uint32_t i=0; i<count; i++) {
+    Element_ptr child = ReadElement(in, file_name, depth+1);
+    if (!child) return nullptr;
+    child->parent = el;
+    el->children.push_back(child);
+  }
+
+  return el;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGXMLFileRead::WriteImage(const SGPath& filename,
+                               const vector<SGPath>& files,
+                               const SGPath& rootDir)
+{
+  // The paths below the root directory are stored relative to it.
+  string root = rootDir.realpath().utf8Str();
+  if (!root.empty() && root.back() != '/') root += '/';
+
+  vector<string> keys;
+  for (auto& file: files) {
+    string key = CacheKey(file);
+    if (find(keys.begin(), keys.end(), key) == keys.end())
+      keys.push_back(key);
+  }
+
+  sg_ofstream out(filename, ios::out | ios::binary);
+
+  if (!out.is_open()) {
+    cerr << "Could not open file: " << filename.utf8Str() << endl;
+    return false;
+  }
+
+  lock_guard<mutex> lock(CacheMutex);
+
+  vector<const pair<const string, CachedDocument>*> entries;
+  for (auto& key: keys) {
+    auto it = Cache.find(key);
+    if (it != Cache.end()) entries.push_back(&*it);
+  }
+
+  out.write(ImageMagic, sizeof(ImageMagic));
+  Write(out, ImageVersion, 4);
+  Write(out, entries.size(), 4);
+
+  for (auto entry: entries) {
+    const string& key = entry->first;
+    if (!root.empty() && key.compare(0, root.size(), root) == 0)
+      Write(out, key.substr(root.size()));
+    else
+      Write(out, key);
+    Write(out, entry->second.size, 8);
+    Write(out, entry->second.hash, 8);
+    WriteElement(out, entry->second.document);
+  }
+
+  if (!out) {
+    cerr << "Could not write the image " << filename.utf8Str() << endl;
+    return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGXMLFileRead::ReadImage(const SGPath& filename, const SGPath& rootDir)
+{
+  string key = filename.realpath().utf8Str();
+  pair<time_t, size_t> stamp(filename.modTime(), filename.sizeInBytes());
+
+  // Skip the images that have already been read by the process.
+  {
+    lock_guard<mutex> lock(CacheMutex);
+    auto it = Images.find(key);
+    if (it != Images.end() && it->second == stamp) return true;
+  }
+
+  sg_ifstream file(filename, ios::in | ios::binary);
+
+  if (!file.is_open()) {
+    cerr << "Could not open file: " << filename.utf8Str() << endl;
+    return false;
+  }
+
+  // The image is read in memory so that the sizes it contains can be checked
+  // against the size of the image (see Available()).
+  ostringstream buffer;
+  buffer << file.rdbuf();
+  file.close();
+  istringstream in(buffer.str());
+
+  char magic[sizeof(ImageMagic)];
+  uint32_t version, count = 0;
+
+  if (!in.read(magic, sizeof(magic))
+      || !equal(magic, magic+sizeof(magic), ImageMagic)
+      || !Read(in, version)) {
+    cerr << filename.utf8Str() << " is not a JSBSim image." << endl;
+    return false;
+  }
+
+  if (version != ImageVersion) {
+    cerr << "The image " << filename.utf8Str() << " has version " << version
+         << " instead of " << ImageVersion << ". It is ignored." << endl;
+    return false;
+  }
+
+  string root = rootDir.realpath().utf8Str();
+  if (!root.empty() && root.back() != '/') root += '/';
+
+  // The image is entirely read before updating the cache so that a corrupted
+  // image leaves the cache unchanged.
+  vector<pair<string, CachedDocument>> documents;
+
+  bool valid = Read(in, count);
+
+  for (uint32_t i=0; valid && i<count; i++) {
+    string path;
+    CachedDocument doc;
+    valid = Read(in, path) && Read(in, doc.size, 8) && Read(in, doc.hash, 8);
+    if (valid) {
+      if (SGPath::fromUtf8(path).isRelative()) path = root + path;
+      doc.document = ReadElement(in, path);
+      valid = doc.document.valid();
+      documents.emplace_back(path, doc);
+    }
+  }
+
+  if (!valid) {
+    cerr << "The image " << filename.utf8Str() << " is corrupted." << endl;
+    return false;
+  }
+
+  lock_guard<mutex> lock(CacheMutex);
+  for (auto& doc: documents) {
+    doc.second.lastUse = ++UseCounter;
+    Cache[doc.first] = doc.second;
+  }
+  Evict();
+  Images[key] = stamp;
+
+  return true;
+}
+
+} // namespace JSBSim
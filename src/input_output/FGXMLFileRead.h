@@ -37,6 +37,7 @@ INCLUDES
 
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 #include "input_output/FGXMLParse.h"
 #include "simgear/misc/sg_path.hxx"
@@ -48,15 +49,40 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+/** Reads XML files.
+
+    The documents read by LoadXMLDocument(const SGPath&, bool) are parsed only
+    once per process: the parsed documents are kept in a cache that is shared
+    by all the instances of FGXMLFileRead, including those that belong to
+    different FGFDMExec instances or run in different threads. The cached
+    documents are never modified: each call returns its own copy of the cached
+    document since the models modify the documents while reading them.
+
+    The cache is keyed on the canonical path of the file. A cached document is
+    reused only if the size and the hash of the file content are unchanged, so
+    files that are modified between two loads are parsed again. Once a file
+    has been hashed, it is not read again as long as its modification time and
+    its size are unchanged. The cache keeps the most recently used documents
+    up to the capacity set by SetCacheCapacity() and can be emptied with
+    ClearCache().
+
+    The cached documents of a list of files can be saved to a binary image
+    with WriteImage() and restored in another process with ReadImage(), so
+    that the documents are not parsed at all. Since the documents of an image are checked like
+    any other cached document, the files modified after the image was written
+    are parsed from XML.
+
+    Preload() fills the cache by parsing several files in parallel. The
+    parsing is the only part of the loading done in parallel: the documents are
+    then read by the models in their usual order, from the cache and without
+    reading the files again.
+ */
 class FGXMLFileRead {
 public:
   FGXMLFileRead(void) {}
   ~FGXMLFileRead(void) {}
 
-  Element* LoadXMLDocument(const SGPath& XML_filename, bool verbose=true)
-  {
-    return LoadXMLDocument(XML_filename, file_parser, verbose);
-  }
+  Element* LoadXMLDocument(const SGPath& XML_filename, bool verbose=true);
 
   Element* LoadXMLDocument(const SGPath& XML_filename, FGXMLParse& fparse, bool verbose=true)
   {
@@ -84,10 +110,65 @@ public:
     return document;
   }
 
-  void ResetParser(void) {file_parser.reset();}
+  void ResetParser(void) {file_parser.reset(); document = nullptr;}
+
+  /// Statistics of the parsed documents cache.
+  struct CacheStatistics {
+    unsigned long hits = 0;
+    unsigned long misses = 0;
+    /// Number of files read from the disk.
+    unsigned long reads = 0;
+    size_t documents = 0;
+  };
+
+  /// Returns the statistics of the parsed documents cache.
+  static CacheStatistics GetCacheStatistics(void);
+  /// Removes all the documents from the cache and resets its statistics.
+  static void ClearCache(void);
+  /** Sets the maximum number of documents kept in the cache. The least
+      recently used documents are removed when the cache is full.
+      @param documents the maximum number of documents. Defaults to 512, 0
+                       disables the cache. */
+  static void SetCacheCapacity(size_t documents);
+
+  /** Writes the cached documents of a list of files to a binary image.
+      @param filename name of the image file
+      @param files the files to write. The files that are not in the cache are
+                   skipped.
+      @param rootDir the paths of the files located below this directory are
+                     stored relative to it so that the image remains valid if
+                     the directory is moved.
+      @return true if successful */
+  static bool WriteImage(const SGPath& filename,
+                         const std::vector<SGPath>& files,
+                         const SGPath& rootDir);
+  /** Adds the documents of a binary image to the cache.
+      @param filename name of the image file
+      @param rootDir the directory to which the relative paths of the image
+                     refer.
+      @return false if the file can not be read, is corrupted or is not an
+              image of the current version, in which case the cache is left
+              unchanged. */
+  static bool ReadImage(const SGPath& filename, const SGPath& rootDir);
+
+  /** Parses files in parallel and adds them to the cache. The files that are
+      already cached or that cannot be read are skipped: the errors are
+      reported when the files are loaded with LoadXMLDocument().
+      @param filenames names of the files to parse
+      @param threads number of threads. Defaults to the number of hardware
+             threads. */
+  static void Preload(const std::vector<SGPath>& filenames,
+                      unsigned int threads=0);
 
 private:
   FGXMLParse file_parser;
+  Element_ptr document;
+
+  Element* ReadDocument(const SGPath& XML_filename, bool verbose,
+                        bool copyCached);
+  static void WriteElement(std::ostream& out, const Element* el);
+  static Element_ptr ReadElement(std::istream& in,
+                                 const std::string& file_name, int depth=0);
 };
 }
 #endif
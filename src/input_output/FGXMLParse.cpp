@@ -51,6 +51,14 @@ void FGXMLParse::reset(void)
 void FGXMLParse::dumpDataLines(void)
 {
   if (!working_string.empty()) {
+    // The table data is converted to numbers right away rather than being
+    // stored as lines of text.
+    if (current_element->GetName() == "tableData"
+        && current_element->AddNumericData(working_string)) {
+      working_string.erase();
+      return;
+    }
+
     for (auto s: split(working_string, '\n'))
       current_element->AddData(s);
   }
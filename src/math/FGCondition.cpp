@@ -34,6 +34,7 @@ COMMENTS, REFERENCES,  and NOTES
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
 #include <iostream>
 #include <cstdlib>
 #include <stdexcept>
@@ -55,7 +56,7 @@ CLASS IMPLEMENTATION
 // This constructor is called when tests are inside an element
 FGCondition::FGCondition(Element* element, std::shared_ptr<FGPropertyManager> PropertyManager)
   : Logic(elUndef), TestParam1(nullptr), TestParam2(nullptr),
-    Comparison(ecUndef)
+    Comparison(ecUndef), Compiled(false)
 {
   InitializeConditionals();
 
@@ -104,7 +105,7 @@ FGCondition::FGCondition(Element* element, std::shared_ptr<FGPropertyManager> Pr
 FGCondition::FGCondition(const string& test, std::shared_ptr<FGPropertyManager> PropertyManager,
                          Element* el)
   : Logic(elUndef), TestParam1(nullptr), TestParam2(nullptr),
-    Comparison(ecUndef)
+    Comparison(ecUndef), Compiled(false)
 {
   InitializeConditionals();
 
@@ -165,6 +166,61 @@ FGCondition::~FGCondition(void)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 bool FGCondition::Evaluate(void )
+{
+  if (Program.empty()) {
+    // The first evaluation binds the properties, then the condition can be
+    // compiled.
+    bool pass = EvaluateTree();
+
+    if (!Compiled) {
+      Compiled = true;
+      if (!Compile(Program, ePass, eFail)) Program.clear();
+    }
+
+    return pass;
+  }
+
+  int next = 0;
+
+  do {
+    const Instruction& test = Program[next];
+    double value1 = test.node1->getDoubleValue()*test.sign1;
+    double value2 = test.node2 ? test.node2->getDoubleValue()*test.sign2
+                               : test.value;
+    bool pass = false;
+
+    switch (test.comparison) {
+    case eEQ:
+      pass = value1 == value2;
+      break;
+    case eNE:
+      pass = value1 != value2;
+      break;
+    case eGT:
+      pass = value1 > value2;
+      break;
+    case eGE:
+      pass = value1 >= value2;
+      break;
+    case eLT:
+      pass = value1 < value2;
+      break;
+    case eLE:
+      pass = value1 <= value2;
+      break;
+    default:
+      break;
+    }
+
+    next = pass ? test.onPass : test.onFail;
+  } while (next >= 0);
+
+  return next == ePass;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCondition::EvaluateTree(void)
 {
   bool pass = false;
 
@@ -174,14 +230,14 @@ bool FGCondition::Evaluate(void )
 
       pass = true;
       for (auto cond: conditions) {
-        if (!cond->Evaluate()) pass = false;
+        if (!cond->EvaluateTree()) pass = false;
       }
 
     } else { // Logic must be eOR
 
       pass = false;
       for (auto cond: conditions) {
-        if (cond->Evaluate()) pass = true;
+        if (cond->EvaluateTree()) pass = true;
       }
 
     }
@@ -222,6 +278,119 @@ bool FGCondition::Evaluate(void )
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+unsigned int FGCondition::GetNumTests(void) const
+{
+  if (TestParam1) return 1;
+
+  unsigned int n = 0;
+  for (auto cond: conditions)
+    n += cond->GetNumTests();
+
+  return n;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Appends the tests of the condition to the program. The tests of a group are
+// laid out in sequence: in an AND group a test that passes branches to the next
+// one and in an OR group a test that fails branches to the next one. The last
+// test branches to the targets of the group.
+
+bool FGCondition::Compile(vector<Instruction>& program, int onPass,
+                          int onFail) const
+{
+  if (TestParam1) {
+    vector<const FGPropertyNode*> nodes1, nodes2;
+
+    if (!TestParam1->GetDependencies(nodes1)
+        || !TestParam2->GetDependencies(nodes2) || nodes2.size() > 1)
+      return false;
+
+    Instruction test;
+    test.node1 = const_cast<FGPropertyNode*>(nodes1[0]);
+    test.sign1 = TestParam1->GetSign();
+    test.node2 = nodes2.empty() ? nullptr : const_cast<FGPropertyNode*>(nodes2[0]);
+    test.sign2 = static_cast<FGParameterValue*>(TestParam2.ptr())->GetSign();
+    test.value = nodes2.empty() ? TestParam2->GetValue() : 0.0;
+    test.comparison = Comparison;
+    test.onPass = onPass;
+    test.onFail = onFail;
+    program.push_back(test);
+
+    return true;
+  }
+
+  // The result of an empty group does not depend on a test.
+  if (conditions.empty()) return false;
+
+  for (unsigned int i=0; i<conditions.size(); i++) {
+    const FGCondition* cond = conditions[i];
+
+    if (i == conditions.size()-1) {
+      if (!cond->Compile(program, onPass, onFail)) return false;
+    } else {
+      int next = program.size() + cond->GetNumTests();
+      if (Logic == eAND) {
+        if (!cond->Compile(program, next, onFail)) return false;
+      } else {
+        if (!cond->Compile(program, onPass, next)) return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCondition::GetDependencies(vector<const FGPropertyNode*>& nodes) const
+{
+  if (TestParam1)
+    return TestParam1->GetDependencies(nodes)
+      && TestParam2->GetDependencies(nodes);
+
+  bool result = true;
+  for (auto cond: conditions)
+    if (!cond->GetDependencies(nodes)) result = false;
+
+  return result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGCondition::GetLowerBound(const FGPropertyNode* node) const
+{
+  if (TestParam1) {
+    vector<const FGPropertyNode*> param1;
+
+    if (TestParam1->GetSign() < 0.0 || !TestParam2->IsConstant()
+        || !TestParam1->GetDependencies(param1) || param1[0] != node)
+      return -HUGE_VAL;
+
+    switch (Comparison) {
+    case eEQ:
+    case eGT:
+    case eGE:
+      return TestParam2->GetValue();
+    default:
+      return -HUGE_VAL;
+    }
+  }
+
+  if (conditions.empty()) return -HUGE_VAL;
+
+  // All the tests of an AND group must pass while only one test of an OR group
+  // needs to pass.
+  double bound = Logic == eAND ? -HUGE_VAL : HUGE_VAL;
+  for (auto cond: conditions) {
+    if (Logic == eAND)
+      bound = max(bound, cond->GetLowerBound(node));
+    else
+      bound = min(bound, cond->GetLowerBound(node));
+  }
+
+  return bound;
+}
+
 void FGCondition::PrintCondition(string indent)
 {
   string scratch;
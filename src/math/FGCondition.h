@@ -57,6 +57,14 @@ CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 /** Encapsulates a condition, which is used in parts of JSBSim including switches
+
+    Once all its properties are bound, the condition is compiled to a flat
+    program: the tests are stored in a single array, their operands are
+    resolved to property nodes or constants, and each test branches to the
+    next test to execute or to the result. A group of tests is therefore
+    short-circuited (an AND group stops at the first test that fails and an OR
+    group at the first test that passes) and Evaluate() no longer walks the
+    tree of conditions.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -72,6 +80,19 @@ public:
   bool Evaluate(void);
   void PrintCondition(std::string indent="  ");
 
+  /** Appends the properties read by the condition to a list.
+      @param nodes the list to which the properties are appended.
+      @return false if the result of the condition does not only depend on the
+              value of these properties. */
+  bool GetDependencies(std::vector<const FGPropertyNode*>& nodes) const;
+
+  /** Returns a bound below which the value of a property makes the condition
+      false whatever the value of the other properties. This is used to
+      schedule the script events that are triggered by the simulation time.
+      @param node the property
+      @return the bound or -HUGE_VAL if the condition sets no such bound. */
+  double GetLowerBound(const FGPropertyNode* node) const;
+
 private:
   FGCondition(const std::string& test, std::shared_ptr<FGPropertyManager> PropertyManager,
               Element* el);
@@ -89,6 +110,25 @@ private:
   std::vector <FGCondition*> conditions;
   void InitializeConditionals(void);
 
+  // A test of the compiled program. The second operand is a constant when
+  // node2 is null. onPass and onFail are the index of the next test or one
+  // of ePass and eFail.
+  struct Instruction {
+    FGPropertyNode* node1;
+    FGPropertyNode* node2;
+    double sign1, sign2, value;
+    eComparison comparison;
+    int onPass, onFail;
+  };
+  enum {eFail=-2, ePass=-1};
+
+  std::vector<Instruction> Program;
+  bool Compiled;
+
+  bool EvaluateTree(void);
+  bool Compile(std::vector<Instruction>& program, int onPass, int onFail) const;
+  unsigned int GetNumTests(void) const;
+
   void Debug(int from);
 };
 }
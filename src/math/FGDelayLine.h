@@ -0,0 +1,133 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGDelayLine.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGDELAYLINE_H
+#define FGDELAYLINE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Models a transport delay with a circular buffer.
+    Each call to Run() stores a sample and returns the delayed signal in
+    constant time whatever the length of the delay.
+
+    The delay is expressed in frames and follows the convention of the FCS
+    components: the frame being executed counts as the first frame of the
+    delay, so a delay of n frames returns the sample received n-1 frames
+    earlier and a delay of 1 frame or less returns the current sample. When
+    the delay is not an integer, the output is linearly interpolated between
+    the two samples that surround it.
+
+    @see FGFCSComponent
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGDelayLine
+{
+public:
+  /// Constructor. The delay line does not delay its input until SetDelay() is
+  /// called.
+  FGDelayLine(void) : Buffer(1, 0.0), Head(0), Lag(0), Fraction(0.0),
+                      Delay(0.0) {}
+
+  /** Sets the length of the delay and clears the history.
+      @param frames the delay in frames. A value that is within 1E-9 of an
+                    integer is rounded to that integer. */
+  void SetDelay(double frames) {
+    double rounded = std::round(frames);
+    if (std::fabs(frames - rounded) < 1E-9) frames = rounded;
+    Delay = std::max(frames, 0.0);
+
+    double samples = std::max(Delay - 1.0, 0.0);
+    Lag = static_cast<unsigned int>(samples);
+    Fraction = samples - Lag;
+    Buffer.assign(Fraction > 0.0 ? Lag + 2 : Lag + 1, 0.0);
+    Head = 0;
+  }
+
+  /// Returns the delay in frames.
+  double GetDelay(void) const { return Delay; }
+
+  /** Stores a sample and returns the delayed signal.
+      @param input the current sample
+      @return the sample received GetDelay()-1 frames earlier. */
+  double Run(double input) {
+    if (++Head == Buffer.size()) Head = 0;
+    Buffer[Head] = input;
+
+    double output = Sample(Lag);
+    if (Fraction > 0.0)
+      output += Fraction * (Sample(Lag+1) - output);
+    return output;
+  }
+
+  /// Sets the whole history to a value.
+  void Fill(double value) { std::fill(Buffer.begin(), Buffer.end(), value); }
+
+  /// Clears the history.
+  void Reset(void) {
+    Fill(0.0);
+    Head = 0;
+  }
+
+private:
+  std::vector<double> Buffer;
+  unsigned int Head;    // index of the latest sample
+  unsigned int Lag;     // integer part of the delay in samples
+  double Fraction;      // fractional part of the delay in samples
+  double Delay;
+
+  double Sample(unsigned int age) const {
+    return Head >= age ? Buffer[Head - age] : Buffer[Head + Buffer.size() - age];
+  }
+};
+} // namespace JSBSim
+#endif
@@ -135,6 +135,11 @@ public:
     return false;
   }
 
+  // Same for their dependencies: they do not depend on any property.
+  bool GetDependencies(vector<const FGPropertyNode*>& nodes) const override {
+    return false;
+  }
+
 protected:
   // The method GetValue() is not bound for functions without parameters because
   // we do not want the property to return a different value each time it is
@@ -213,6 +218,14 @@ FGFunction::FGFunction(FGFDMExec* fdmex, Element* el, const string& prefix,
   CheckMinArguments(el, 1);
   CheckMaxArguments(el, 1);
 
+  // Only the named functions are profiled.
+  if (pNode) {
+    string root = PropertyManager->GetNode()->GetFullyQualifiedName() + "/";
+    Profiler = fdmex->GetProfiler();
+    ProfileSection = Profiler->Register(FGProfiler::eFunction,
+                                        pNode->GetRelativeName(root));
+  }
+
   string sCopyTo = el->GetAttributeValue("copyto");
 
   if (!sCopyTo.empty()) {
@@ -910,6 +923,20 @@ bool FGFunction::IsConstant(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGFunction::GetDependencies(vector<const FGPropertyNode*>& nodes) const
+{
+  if (pCopyTo) return false;
+
+  for (auto p: Parameters) {
+    if (!p->GetDependencies(nodes))
+      return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFunction::cacheValue(bool cache)
 {
   cached = false; // Must set cached to false prior to calling GetValue(), else
@@ -926,6 +953,7 @@ double FGFunction::GetValue(void) const
 {
   if (cached) return cachedValue;
 
+  FGProfiler::Scope scope(Profiler, ProfileSection);
   double val = Parameters[0]->GetValue();
 
   if (pCopyTo) pCopyTo->setDoubleValue(val);
@@ -38,6 +38,7 @@ INCLUDES
 
 #include "FGParameter.h"
 #include "input_output/FGPropertyManager.h"
+#include "input_output/FGProfiler.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -756,7 +757,8 @@ class FGFunction : public FGParameter, public FGJSBBase
 public:
   /// Default constructor.
   FGFunction()
-    : cached(false), cachedValue(-HUGE_VAL), pNode(nullptr), pCopyTo(nullptr) {}
+    : cached(false), cachedValue(-HUGE_VAL), pNode(nullptr), pCopyTo(nullptr),
+      Profiler(nullptr), ProfileSection(-1) {}
 
   explicit FGFunction(std::shared_ptr<FGPropertyManager> pm)
     : FGFunction()
@@ -802,6 +804,11 @@ public:
     constant parameters) ? */
   bool IsConstant(void) const override;
 
+/** Appends the properties read by the function to a list. Functions that
+    write their result to a property (see \<function copy_to="..."\>) are
+    not considered to only depend on their inputs. */
+  bool GetDependencies(std::vector<const FGPropertyNode*>& nodes) const override;
+
 /** Specifies whether to cache the value of the function, so it is calculated
     only once per frame.
     If shouldCache is true, then the value of the function is calculated, and a
@@ -812,6 +819,22 @@ public:
     value. */
   void cacheValue(bool shouldCache);
 
+/** Sets the value that the function returns until the next call to
+    cacheValue(). It is used to share the result of a function with other
+    identical functions.
+    @param value the value to return. */
+  void SetCachedValue(double value) {
+    cachedValue = value;
+    cached = true;
+  }
+
+/** Copies the cached value of a function (see FGFDMExec::Clone()).
+    @param source a function built from the same definition. */
+  void CopyCachedValue(const FGFunction& source) {
+    cachedValue = source.cachedValue;
+    cached = source.cached;
+  }
+
   enum class OddEven {Either, Odd, Even};
 
 protected:
@@ -832,6 +855,8 @@ protected:
 private:
   std::string Name;
   FGPropertyNode_ptr pCopyTo; // Property node for CopyTo property string
+  FGProfiler* Profiler;
+  int ProfileSection;
 
   void Debug(int from);
 };
@@ -65,6 +65,8 @@ public:
     :FGPropertyValue(propName, propertyManager, el), function(f) {}
 
   double GetValue(void) const override { return function->GetValue(GetNode()); }
+  bool GetDependencies(std::vector<const FGPropertyNode*>& nodes) const override
+  { return false; }
 
   std::string GetName(void) const override {
     return function->GetName() + "(" + FGPropertyValue::GetName() + ")";
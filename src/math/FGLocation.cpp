@@ -258,11 +258,18 @@ void FGLocation::SetPositionGeodetic(double lon, double lat, double height)
 
 void FGLocation::SetEllipse(double semimajor, double semiminor)
 {
+  double ratio = semiminor/semimajor;
+
+  // The cached values remain valid if the ellipse is unchanged. This is
+  // notably the case when a location is copied before being passed to a ground
+  // callback.
+  if (mEllipseSet && a == semimajor && ec == ratio) return;
+
   mCacheValid = false;
   mEllipseSet = true;
 
   a = semimajor;
-  ec = semiminor/a;
+  ec = ratio;
   ec2 = ec * ec;
   e2 = 1.0 - ec2;
   c = a * e2;
@@ -282,6 +289,8 @@ double FGLocation::GetSeaLevelRadius(void) const
 
 void FGLocation::ComputeDerivedUnconditional(void) const
 {
+  ++mNumComputeDerived;
+
   // The radius is just the Euclidean norm of the vector.
   mRadius = mECLoc.Magnitude();
 
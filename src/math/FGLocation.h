@@ -477,6 +477,12 @@ public:
     return mECLoc;
   }
 
+  /** Number of times the derived values (geodetic coordinates and
+      transformation matrices) of this instance have been computed. The count
+      is not transferred by copies: a copy made while the derived values are
+      valid shares them without computing them again. */
+  unsigned long GetNumComputeDerived(void) const { return mNumComputeDerived; }
+
 private:
   /** Computation of derived values.
       This function re-computes the derived values like lat/lon and
@@ -531,6 +537,7 @@ private:
   // Flag that checks that geodetic methods are called after SetEllipse() has
   // been called.
   bool mEllipseSet = false;
+  mutable unsigned long mNumComputeDerived = 0;
 };
 
 /** Scalar multiplication.
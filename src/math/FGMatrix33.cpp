@@ -231,8 +231,10 @@ FGMatrix33 FGMatrix33::Inverse(void) const {
   // I guess googling for cramers rule gives tons of references
   // for this. :)
 
-  if (Determinant() != 0.0) {
-    double rdet = 1.0/Determinant();
+  double det = Determinant();
+
+  if (det != 0.0) {
+    double rdet = 1.0/det;
 
     double i11 = rdet*(data[4]*data[8]-data[7]*data[5]);
     double i21 = rdet*(data[7]*data[2]-data[1]*data[8]);
@@ -377,25 +379,6 @@ FGMatrix33& FGMatrix33::operator*=(const double scalar)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-FGMatrix33 FGMatrix33::operator*(const FGMatrix33& M) const
-{
-  FGMatrix33 Product;
-
-  Product.data[0] = data[0]*M.data[0] + data[3]*M.data[1] + data[6]*M.data[2];
-  Product.data[3] = data[0]*M.data[3] + data[3]*M.data[4] + data[6]*M.data[5];
-  Product.data[6] = data[0]*M.data[6] + data[3]*M.data[7] + data[6]*M.data[8];
-  Product.data[1] = data[1]*M.data[0] + data[4]*M.data[1] + data[7]*M.data[2];
-  Product.data[4] = data[1]*M.data[3] + data[4]*M.data[4] + data[7]*M.data[5];
-  Product.data[7] = data[1]*M.data[6] + data[4]*M.data[7] + data[7]*M.data[8];
-  Product.data[2] = data[2]*M.data[0] + data[5]*M.data[1] + data[8]*M.data[2];
-  Product.data[5] = data[2]*M.data[3] + data[5]*M.data[4] + data[8]*M.data[5];
-  Product.data[8] = data[2]*M.data[6] + data[5]*M.data[7] + data[8]*M.data[8];
-
-  return Product;
-}
-
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
 FGMatrix33& FGMatrix33::operator*=(const FGMatrix33& M)
 {
   // FIXME: Make compiler friendlier
@@ -482,27 +465,5 @@ void FGMatrix33::T(void)
   data[5] = tmp;
 }
 
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
-FGColumnVector3 FGMatrix33::operator*(const FGColumnVector3& v) const
-{
-  double v1 = v(1);
-  double v2 = v(2);
-  double v3 = v(3);
-
-  double tmp1 = v1*data[0];  //[(col-1)*eRows+row-1]
-  double tmp2 = v1*data[1];
-  double tmp3 = v1*data[2];
-
-  tmp1 += v2*data[3];
-  tmp2 += v2*data[4];
-  tmp3 += v2*data[5];
-
-  tmp1 += v3*data[6];
-  tmp2 += v3*data[7];
-  tmp3 += v3*data[8];
-
-  return FGColumnVector3( tmp1, tmp2, tmp3 );
-}
 
 }
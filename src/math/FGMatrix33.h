@@ -345,7 +345,54 @@ public:
       Compute and return the product of the current matrix with the
       vector given in the argument.
    */
-  FGColumnVector3 operator*(const FGColumnVector3& v) const;
+  FGColumnVector3 operator*(const FGColumnVector3& v) const {
+    double v1 = v(1);
+    double v2 = v(2);
+    double v3 = v(3);
+
+    double tmp1 = v1*data[0];  //[(col-1)*eRows+row-1]
+    double tmp2 = v1*data[1];
+    double tmp3 = v1*data[2];
+
+    tmp1 += v2*data[3];
+    tmp2 += v2*data[4];
+    tmp3 += v2*data[5];
+
+    tmp1 += v3*data[6];
+    tmp2 += v3*data[7];
+    tmp3 += v3*data[8];
+
+    return FGColumnVector3( tmp1, tmp2, tmp3 );
+  }
+
+  /** Transposed matrix vector multiplication.
+
+      @param v vector to multiply with.
+      @return product of the transposed matrix with the vector.
+
+      Compute and return the product of the transpose of the current matrix
+      with the vector given in the argument, without building the transposed
+      matrix. The result is exactly the same as <tt>Transposed()*v</tt>.
+   */
+  FGColumnVector3 TransposedProduct(const FGColumnVector3& v) const {
+    double v1 = v(1);
+    double v2 = v(2);
+    double v3 = v(3);
+
+    double tmp1 = v1*data[0];
+    double tmp2 = v1*data[3];
+    double tmp3 = v1*data[6];
+
+    tmp1 += v2*data[1];
+    tmp2 += v2*data[4];
+    tmp3 += v2*data[7];
+
+    tmp1 += v3*data[2];
+    tmp2 += v3*data[5];
+    tmp3 += v3*data[8];
+
+    return FGColumnVector3( tmp1, tmp2, tmp3 );
+  }
 
   /** Matrix subtraction.
 
@@ -375,7 +422,18 @@ public:
       Compute and return the product of the current matrix and the matrix
       B given in the argument.
   */
-  FGMatrix33 operator*(const FGMatrix33& B) const;
+  FGMatrix33 operator*(const FGMatrix33& B) const {
+    return FGMatrix33(
+      data[0]*B.data[0] + data[3]*B.data[1] + data[6]*B.data[2],
+      data[0]*B.data[3] + data[3]*B.data[4] + data[6]*B.data[5],
+      data[0]*B.data[6] + data[3]*B.data[7] + data[6]*B.data[8],
+      data[1]*B.data[0] + data[4]*B.data[1] + data[7]*B.data[2],
+      data[1]*B.data[3] + data[4]*B.data[4] + data[7]*B.data[5],
+      data[1]*B.data[6] + data[4]*B.data[7] + data[7]*B.data[8],
+      data[2]*B.data[0] + data[5]*B.data[1] + data[8]*B.data[2],
+      data[2]*B.data[3] + data[5]*B.data[4] + data[8]*B.data[5],
+      data[2]*B.data[6] + data[5]*B.data[7] + data[8]*B.data[8] );
+  }
 
   /** Multiply the matrix with a scalar.
 
@@ -110,10 +110,75 @@ void FGModelFunctions::PostLoad(Element* el, FGFDMExec* fdmex, string prefix)
 
 void FGModelFunctions::RunPreFunctions(void)
 {
+  if (UseSharedPreFunctions && !SharedPreFunctions.empty()) {
+    for (size_t i=0; i<PreFunctions.size(); i++) {
+      if (SharedPreFunctions[i])
+        PreFunctions[i]->SetCachedValue(SharedPreFunctions[i]->GetValue());
+      else
+        PreFunctions[i]->cacheValue(true);
+    }
+    return;
+  }
+
   for (auto& prefunc: PreFunctions)
     prefunc->cacheValue(true);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGModelFunctions::CopyFunctionValues(const FGModelFunctions& source)
+{
+  for (unsigned int i=0; i < PreFunctions.size(); i++)
+    PreFunctions[i]->CopyCachedValue(*source.PreFunctions[i]);
+
+  for (unsigned int i=0; i < PostFunctions.size(); i++)
+    PostFunctions[i]->CopyCachedValue(*source.PostFunctions[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGModelFunctions::SharePreFunctions(const FGModelFunctions& source,
+                                                 const FGPropertyNode* excluded)
+{
+  unsigned int count = 0;
+
+  SharedPreFunctions.assign(PreFunctions.size(), nullptr);
+  if (PreFunctions.size() != source.PreFunctions.size()) return 0;
+
+  auto BaseName = [](const string& name) {
+    return name.substr(name.find_last_of('/')+1);
+  };
+
+  for (size_t i=0; i<PreFunctions.size(); i++) {
+    const FGFunction* function = PreFunctions[i].get();
+    const FGFunction* shared = source.PreFunctions[i].get();
+    vector<const FGPropertyNode*> nodes, sharedNodes;
+
+    if (BaseName(function->GetName()) != BaseName(shared->GetName())) continue;
+    if (!function->GetDependencies(nodes)) continue;
+    if (!shared->GetDependencies(sharedNodes) || nodes != sharedNodes) continue;
+
+    bool independent = true;
+    for (const SGPropertyNode* node: nodes) {
+      for (; node; node = node->getParent()) {
+        if (node == excluded) {
+          independent = false;
+          break;
+        }
+      }
+    }
+
+    if (independent) {
+      SharedPreFunctions[i] = shared;
+      ++count;
+    }
+  }
+
+  if (count == 0) SharedPreFunctions.clear();
+
+  return count;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Tell the Functions to cache values, so when the function values
 // are being used in the model, the functions do not get
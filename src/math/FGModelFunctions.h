@@ -46,6 +46,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGFunction;
+class FGPropertyNode;
 class Element;
 class FGPropertyManager;
 class FGFDMExec;
@@ -97,9 +98,35 @@ public:
    */
   std::shared_ptr<FGFunction> GetPreFunction(const std::string& name);
 
+  /** Shares the "pre" functions with a model loaded from the same definition.
+      A function is shared when it has the same name and position in both
+      models and reads exactly the same properties, none of which belong to
+      the subtree of the property node excluded. While the sharing is enabled,
+      RunPreFunctions() copies the values of the shared functions from the
+      source model instead of evaluating them, so the source model must run
+      its "pre" functions first.
+      @param source the model that evaluates the shared functions
+      @param excluded the root of the properties that can be modified between
+                      the evaluation of the functions in the source model and
+                      the execution of this model.
+      @return the number of functions that are shared. */
+  unsigned int SharePreFunctions(const FGModelFunctions& source,
+                                 const FGPropertyNode* excluded);
+  /// Enables or disables the sharing of the "pre" functions.
+  void EnableSharedPreFunctions(bool enable) { UseSharedPreFunctions = enable; }
+
+  /** Copies the cached values of the "pre" and "post" functions (see
+      FGFDMExec::Clone()).
+      @param source a model loaded from the same definition. */
+  void CopyFunctionValues(const FGModelFunctions& source);
+
 protected:
   std::vector <std::shared_ptr<FGFunction>> PreFunctions;
   std::vector <std::shared_ptr<FGFunction>> PostFunctions;
+  // Function of the source model for each shared "pre" function, nullptr
+  // otherwise.
+  std::vector <const FGFunction*> SharedPreFunctions;
+  bool UseSharedPreFunctions = false;
   FGPropertyReader LocalProperties;
 
   virtual bool InitModel(void);
@@ -35,6 +35,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <string>
+#include <vector>
 #include "simgear/structure/SGSharedPtr.hxx"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -43,6 +44,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGPropertyNode;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -62,6 +65,13 @@ public:
   virtual double GetValue(void) const = 0;
   virtual std::string GetName(void) const = 0;
   virtual bool IsConstant(void) const { return false; }
+  /** Appends the properties read by the parameter to a list.
+      @param nodes the list to which the properties are appended.
+      @return false if the value of the parameter does not only depend on the
+              value of these properties (random numbers, properties that are
+              not bound yet, etc.) */
+  virtual bool GetDependencies(std::vector<const FGPropertyNode*>& nodes) const
+  { return false; }
 
   // SGPropertyNode impersonation.
   double getDoubleValue(void) const { return GetValue(); }
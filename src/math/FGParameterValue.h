@@ -89,6 +89,8 @@ public:
 
   double GetValue(void) const override { return param->GetValue(); }
   bool IsConstant(void) const override { return param->IsConstant(); }
+  bool GetDependencies(std::vector<const FGPropertyNode*>& nodes) const override
+  { return param->GetDependencies(nodes); }
 
   std::string GetName(void) const override {
     FGPropertyValue* v = dynamic_cast<FGPropertyValue*>(param.ptr());
@@ -102,6 +104,12 @@ public:
     FGPropertyValue* v = dynamic_cast<FGPropertyValue*>(param.ptr());
     return v != nullptr && v->IsLateBound();
   }
+
+  /// Returns -1 if the value is a negated property, 1 otherwise.
+  double GetSign(void) const {
+    FGPropertyValue* v = dynamic_cast<FGPropertyValue*>(param.ptr());
+    return v ? v->GetSign() : 1.0;
+  }
 private:
   FGParameter_ptr param;
 };
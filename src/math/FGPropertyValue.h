@@ -73,9 +73,16 @@ public:
     return PropertyNode && (!PropertyNode->isTied()
                          && !PropertyNode->getAttribute(SGPropertyNode::WRITE));
   }
+  bool GetDependencies(std::vector<const FGPropertyNode*>& nodes) const override {
+    if (!PropertyNode) return false;
+    nodes.push_back(PropertyNode);
+    return true;
+  }
   void SetNode(FGPropertyNode* node) {PropertyNode = node;}
   void SetValue(double value);
   bool IsLateBound(void) const { return PropertyNode == nullptr; }
+  /// Returns -1 if the property value is negated, 1 otherwise.
+  double GetSign(void) const { return Sign; }
 
   std::string GetName(void) const override;
   virtual std::string GetNameWithSign(void) const;
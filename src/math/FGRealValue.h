@@ -63,6 +63,8 @@ public:
   double GetValue(void) const override { return Value; };
   std::string GetName(void) const override;
   bool IsConstant(void) const override { return true; }
+  bool GetDependencies(std::vector<const FGPropertyNode*>& nodes) const override
+  { return true; }
 
 private:
   const double Value;
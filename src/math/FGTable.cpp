@@ -37,6 +37,10 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <assert.h>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
 
 #include "FGTable.h"
 #include "input_output/FGXMLElement.h"
@@ -45,6 +49,16 @@ using namespace std;
 
 namespace JSBSim {
 
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+GLOBAL DATA
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Data of the tables read from XML indexed by the hash of their content. The
+// entries are removed when the last table that uses them is destroyed.
+static std::mutex InternMutex;
+static std::unordered_multimap<uint64_t, std::weak_ptr<const std::vector<double>>> InternedData;
+static size_t PurgeThreshold = 1024;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -55,7 +69,7 @@ FGTable::FGTable(int NRows)
   Type = tt1D;
   colCounter = 0;
   rowCounter = 1;
-  Data = Allocate();
+  Allocate();
   Debug(0);
   lastRowIndex=lastColumnIndex=2;
 }
@@ -68,7 +82,7 @@ FGTable::FGTable(int NRows, int NCols)
   Type = tt2D;
   colCounter = 1;
   rowCounter = 0;
-  Data = Allocate();
+  Allocate();
   Debug(0);
   lastRowIndex=lastColumnIndex=2;
 }
@@ -89,13 +103,15 @@ FGTable::FGTable(const FGTable& t)
   lookupProperty[1] = t.lookupProperty[1];
   lookupProperty[2] = t.lookupProperty[2];
 
-  Tables = t.Tables;
-  Data = Allocate();
-  for (unsigned int r=0; r<=nRows; r++) {
-    for (unsigned int c=0; c<=nCols; c++) {
-      Data[r][c] = t.Data[r][c];
-    }
-  }
+  // The data is shared with the original table unless the latter can still
+  // modify it.
+  if (t.WritableData) {
+    WritableData = std::make_shared<std::vector<double>>(*t.WritableData);
+    Data = WritableData;
+  } else
+    Data = t.Data;
+  for (auto table: t.Tables)
+    Tables.push_back(new FGTable(*table));
   lastRowIndex = t.lastRowIndex;
   lastColumnIndex = t.lastColumnIndex;
 }
@@ -116,6 +132,14 @@ unsigned int FindNumColumns(const string& test_line)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+unsigned int FindNumColumns(Element* tableData, unsigned int line)
+{
+  if (tableData->HasNumericData()) return tableData->GetNumDataValues(line);
+  return FindNumColumns(tableData->GetDataLine(line));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
                  const std::string& Prefix)
   : PropertyManager(pm)
@@ -206,9 +230,10 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
       dimension = 3; // this is a 3D table
     } else {
       tableData = el->FindElement("tableData");
-      string test_line = tableData->GetDataLine(1);  // examine second line in table for dimension
-      if (FindNumColumns(test_line) == 2) dimension = 1;    // 1D table
-      else if (FindNumColumns(test_line) > 2) dimension = 2; // 2D table
+      // examine second line in table for dimension
+      unsigned int numColumns = FindNumColumns(tableData, 1);
+      if (numColumns == 2) dimension = 1;    // 1D table
+      else if (numColumns > 2) dimension = 2; // 2D table
       else {
         std::cerr << tableData->ReadFrom()
                   << "Invalid number of columns in table" << endl;
@@ -235,15 +260,18 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
     dimension = 2;                             // Currently, infers 2D table
   }
 
-  for (i=0; i<tableData->GetNumDataLines(); i++) {
-    string line = tableData->GetDataLine(i);
-    if (line.find_first_not_of("0123456789.-+eE \t\n") != string::npos) {
-      cerr << " In file " << tableData->GetFileName() << endl
-           << "   Illegal character found in line "
-           << tableData->GetLineNumber() + i + 1 << ": " << endl << line << endl;
-      throw TableException("Illegal character");
+  // The data converted to numbers by the XML parser has already been checked.
+  if (!tableData->HasNumericData()) {
+    for (i=0; i<tableData->GetNumDataLines(); i++) {
+      string line = tableData->GetDataLine(i);
+      if (line.find_first_not_of("0123456789.-+eE \t\n") != string::npos) {
+        cerr << " In file " << tableData->GetFileName() << endl
+             << "   Illegal character found in line "
+             << tableData->GetLineNumber() + i + 1 << ": " << endl << line << endl;
+        throw TableException("Illegal character");
+      }
+      buf << line << " ";
     }
-    buf << line << " ";
   }
 
   switch (dimension) {
@@ -253,16 +281,19 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
     Type = tt1D;
     colCounter = 0;
     rowCounter = 1;
-    Data = Allocate();
+    Allocate();
     Debug(0);
     lastRowIndex = lastColumnIndex = 2;
-    *this << buf;
+    if (tableData->HasNumericData())
+      ReadData(tableData->GetNumericData());
+    else
+      *this << buf;
     break;
   case 2:
     nRows = tableData->GetNumDataLines()-1;
 
     if (nRows >= 2) {
-      nCols = FindNumColumns(tableData->GetDataLine(0));
+      nCols = FindNumColumns(tableData, 0);
       if (nCols < 2) {
         std::cerr << tableData->ReadFrom()
                   << "Not enough columns in table data" << endl;
@@ -278,9 +309,12 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
     colCounter = 1;
     rowCounter = 0;
 
-    Data = Allocate();
+    Allocate();
     lastRowIndex = lastColumnIndex = 2;
-    *this << buf;
+    if (tableData->HasNumericData())
+      ReadData(tableData->GetNumericData());
+    else
+      *this << buf;
     break;
   case 3:
     nRows = el->GetNumElements("tableData");
@@ -290,11 +324,11 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
     rowCounter = 1;
     lastRowIndex = lastColumnIndex = 2;
 
-    Data = Allocate(); // this data array will contain the keys for the associated tables
+    Allocate(); // this data array will contain the keys for the associated tables
     tableData = el->FindElement("tableData");
     for (i=0; i<nRows; i++) {
       Tables.push_back(new FGTable(PropertyManager, tableData));
-      Data[i+1][1] = tableData->GetAttributeValueAsNumber("breakPoint");
+      GetWritableData()[(i+1)*(nCols+1)+1] = tableData->GetAttributeValueAsNumber("breakPoint");
       Tables[i]->lookupProperty[eRow] = lookupProperty[eRow];
       Tables[i]->lookupProperty[eColumn] = lookupProperty[eColumn];
       tableData = el->FindNextElement("tableData");
@@ -319,14 +353,14 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
   // check breakpoints, if applicable
   if (dimension > 2) {
     for (b=2; b<=Tables.size(); ++b) {
-      if (Data[b][1] <= Data[b-1][1]) {
+      if (GetElement(b, 1) <= GetElement(b-1, 1)) {
         std::cerr << el->ReadFrom()
                   << fgred << highint
                   << "  FGTable: breakpoint lookup is not monotonically increasing" << endl
                   << "  in breakpoint " << b;
         if (nameel != 0) std::cerr << " of table in " << nameel->GetAttributeValue("name");
         std::cerr << ":" << reset << endl
-                  << "  " << Data[b][1] << "<=" << Data[b-1][1] << endl;
+                  << "  " << GetElement(b, 1) << "<=" << GetElement(b-1, 1) << endl;
         throw TableException("Breakpoint lookup is not monotonically increasing");
       }
     }
@@ -335,14 +369,14 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
   // check columns, if applicable
   if (dimension > 1) {
     for (c=2; c<=nCols; ++c) {
-      if (Data[0][c] <= Data[0][c-1]) {
+      if (GetElement(0, c) <= GetElement(0, c-1)) {
         std::cerr << el->ReadFrom()
                   << fgred << highint
                   << "  FGTable: column lookup is not monotonically increasing" << endl
                   << "  in column " << c;
         if (nameel != 0) std::cerr << " of table in " << nameel->GetAttributeValue("name");
         std::cerr << ":" << reset << endl
-                  << "  " << Data[0][c] << "<=" << Data[0][c-1] << endl;
+                  << "  " << GetElement(0, c) << "<=" << GetElement(0, c-1) << endl;
         throw TableException("FGTable: column lookup is not monotonically increasing");
       }
     }
@@ -351,19 +385,20 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
   // check rows
   if (dimension < 3) { // in 3D tables, check only rows of subtables
     for (r=2; r<=nRows; ++r) {
-      if (Data[r][0]<=Data[r-1][0]) {
+      if (GetElement(r, 0) <= GetElement(r-1, 0)) {
         std::cerr << el->ReadFrom()
                   << fgred << highint
                   << "  FGTable: row lookup is not monotonically increasing" << endl
                   << "  in row " << r;
         if (nameel != 0) std::cerr << " of table in " << nameel->GetAttributeValue("name");
         std::cerr << ":" << reset << endl
-                  << "  " << Data[r][0] << "<=" << Data[r-1][0] << endl;
+                  << "  " << GetElement(r, 0) << "<=" << GetElement(r-1, 0) << endl;
         throw TableException("FGTable: row lookup is not monotonically increasing");
       }
     }
   }
 
+  Intern();
   bind(el, Prefix);
 
   if (debug_lvl & 1) Print();
@@ -371,16 +406,92 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-double** FGTable::Allocate(void)
+void FGTable::Allocate(void)
 {
-  Data = new double*[nRows+1];
-  for (unsigned int r=0; r<=nRows; r++) {
-    Data[r] = new double[nCols+1];
-    for (unsigned int c=0; c<=nCols; c++) {
-      Data[r][c] = 0.0;
+  WritableData = std::make_shared<std::vector<double>>((nRows+1)*(nCols+1), 0.0);
+  Data = WritableData;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The data is copied before being modified if it may be shared with other
+// tables.
+
+double* FGTable::GetWritableData(void)
+{
+  if (!WritableData) {
+    WritableData = std::make_shared<std::vector<double>>(*Data);
+    Data = WritableData;
+  }
+
+  return WritableData->data();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Replaces the data by the data of a table with the same content, if any. The
+// content is compared bitwise so that 0.0 and -0.0 are not confused.
+
+void FGTable::Intern(void)
+{
+  // Once interned, the data can be shared with any other table.
+  WritableData.reset();
+
+  const size_t size = Data->size()*sizeof(double);
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(Data->data());
+  uint64_t hash = 14695981039346656037ULL; // FNV-1a
+  for (size_t i=0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+
+  std::lock_guard<std::mutex> lock(InternMutex);
+
+  auto range = InternedData.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    auto data = it->second.lock();
+    if (data && data->size() == Data->size()
+        && memcmp(data->data(), bytes, size) == 0) {
+      Data = data;
+      return;
     }
   }
-  return Data;
+
+  if (InternedData.size() >= PurgeThreshold) {
+    for (auto it = InternedData.begin(); it != InternedData.end();) {
+      if (it->second.expired())
+        it = InternedData.erase(it);
+      else
+        ++it;
+    }
+    PurgeThreshold = std::max<size_t>(1024, 2*InternedData.size());
+  }
+
+  InternedData.emplace(hash, Data);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTable::MemoryUsage FGTable::GetMemoryUsage(void)
+{
+  MemoryUsage usage {0, 0, 0, 0};
+  std::lock_guard<std::mutex> lock(InternMutex);
+
+  for (auto it = InternedData.begin(); it != InternedData.end();) {
+    auto data = it->second.lock();
+    if (!data) {
+      it = InternedData.erase(it);
+      continue;
+    }
+
+    size_t tables = data.use_count() - 1; // Not counting the local copy
+    size_t bytes = sizeof(*data) + data->capacity()*sizeof(double);
+    usage.buffers++;
+    usage.tables += tables;
+    usage.bytes += bytes;
+    usage.unsharedBytes += tables*bytes;
+    ++it;
+  }
+
+  return usage;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -397,8 +508,6 @@ FGTable::~FGTable()
   }
 
   for (auto t: Tables) delete t;
-  for (unsigned int r=0; r<=nRows; r++) delete[] Data[r];
-  delete[] Data;
 
   Debug(1);
 }
@@ -436,21 +545,36 @@ double FGTable::GetValue(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGTable::GetDependencies(vector<const FGPropertyNode*>& nodes) const
+{
+  if (internal) return false;
+
+  for (unsigned int i=0; i<=static_cast<unsigned int>(Type); i++) {
+    if (!lookupProperty[i] || !lookupProperty[i]->GetDependencies(nodes))
+      return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGTable::GetValue(double key) const
 {
   double Factor, Value, Span;
   unsigned int r = lastRowIndex;
+  const double* data = Data->data(); // Rows of 2 elements: key, value
 
   //if the key is off the end of the table, just return the
   //end-of-table value, do not extrapolate
-  if( key <= Data[1][0] ) {
+  if( key <= data[2] ) {
     lastRowIndex=2;
     //cout << "Key underneath table: " << key << endl;
-    return Data[1][1];
-  } else if ( key >= Data[nRows][0] ) {
+    return data[3];
+  } else if ( key >= data[2*nRows] ) {
     lastRowIndex=nRows;
     //cout << "Key over table: " << key << endl;
-    return Data[nRows][1];
+    return data[2*nRows+1];
   }
 
   // the key is somewhere in the middle, search for the right breakpoint
@@ -458,21 +582,21 @@ double FGTable::GetValue(double key) const
   // the correct breakpoint has not changed since last frame or
   // has only changed very little
 
-  while (r > 2     && Data[r-1][0] > key) { r--; }
-  while (r < nRows && Data[r][0]   < key) { r++; }
+  while (r > 2     && data[2*(r-1)] > key) { r--; }
+  while (r < nRows && data[2*r]     < key) { r++; }
 
   lastRowIndex=r;
   // make sure denominator below does not go to zero.
 
-  Span = Data[r][0] - Data[r-1][0];
+  Span = data[2*r] - data[2*(r-1)];
   if (Span != 0.0) {
-    Factor = (key - Data[r-1][0]) / Span;
+    Factor = (key - data[2*(r-1)]) / Span;
     if (Factor > 1.0) Factor = 1.0;
   } else {
     Factor = 1.0;
   }
 
-  Value = Factor*(Data[r][1] - Data[r-1][1]) + Data[r-1][1];
+  Value = Factor*(data[2*r+1] - data[2*(r-1)+1]) + data[2*(r-1)+1];
 
   return Value;
 }
@@ -484,18 +608,20 @@ double FGTable::GetValue(double rowKey, double colKey) const
   double rFactor, cFactor, col1temp, col2temp, Value;
   unsigned int r = lastRowIndex;
   unsigned int c = lastColumnIndex;
+  const double* data = Data->data();
+  const unsigned int n = nCols+1; // Number of elements per row
 
-  while(r > 2     && Data[r-1][0] > rowKey) { r--; }
-  while(r < nRows && Data[r]  [0] < rowKey) { r++; }
+  while(r > 2     && data[(r-1)*n] > rowKey) { r--; }
+  while(r < nRows && data[r*n]     < rowKey) { r++; }
 
-  while(c > 2     && Data[0][c-1] > colKey) { c--; }
-  while(c < nCols && Data[0][c]   < colKey) { c++; }
+  while(c > 2     && data[c-1] > colKey) { c--; }
+  while(c < nCols && data[c]   < colKey) { c++; }
 
   lastRowIndex=r;
   lastColumnIndex=c;
 
-  rFactor = (rowKey - Data[r-1][0]) / (Data[r][0] - Data[r-1][0]);
-  cFactor = (colKey - Data[0][c-1]) / (Data[0][c] - Data[0][c-1]);
+  rFactor = (rowKey - data[(r-1)*n]) / (data[r*n] - data[(r-1)*n]);
+  cFactor = (colKey - data[c-1]) / (data[c] - data[c-1]);
 
   if (rFactor > 1.0) rFactor = 1.0;
   else if (rFactor < 0.0) rFactor = 0.0;
@@ -503,8 +629,8 @@ double FGTable::GetValue(double rowKey, double colKey) const
   if (cFactor > 1.0) cFactor = 1.0;
   else if (cFactor < 0.0) cFactor = 0.0;
 
-  col1temp = rFactor*(Data[r][c-1] - Data[r-1][c-1]) + Data[r-1][c-1];
-  col2temp = rFactor*(Data[r][c] - Data[r-1][c]) + Data[r-1][c];
+  col1temp = rFactor*(data[r*n+c-1] - data[(r-1)*n+c-1]) + data[(r-1)*n+c-1];
+  col2temp = rFactor*(data[r*n+c] - data[(r-1)*n+c]) + data[(r-1)*n+c];
 
   Value = col1temp + cFactor*(col2temp - col1temp);
 
@@ -517,14 +643,15 @@ double FGTable::GetValue(double rowKey, double colKey, double tableKey) const
 {
   double Factor, Value, Span;
   unsigned int r = lastRowIndex;
+  const double* data = Data->data(); // Rows of 2 elements: unused, key
 
   //if the key is off the end  (or before the beginning) of the table,
   // just return the boundary-table value, do not extrapolate
 
-  if( tableKey <= Data[1][1] ) {
+  if( tableKey <= data[3] ) {
     lastRowIndex=2;
     return Tables[0]->GetValue(rowKey, colKey);
-  } else if ( tableKey >= Data[nRows][1] ) {
+  } else if ( tableKey >= data[2*nRows+1] ) {
     lastRowIndex=nRows;
     return Tables[nRows-1]->GetValue(rowKey, colKey);
   }
@@ -534,15 +661,15 @@ double FGTable::GetValue(double rowKey, double colKey, double tableKey) const
   // the correct breakpoint has not changed since last frame or
   // has only changed very little
 
-  while(r > 2     && Data[r-1][1] > tableKey) { r--; }
-  while(r < nRows && Data[r]  [1] < tableKey) { r++; }
+  while(r > 2     && data[2*(r-1)+1] > tableKey) { r--; }
+  while(r < nRows && data[2*r+1]     < tableKey) { r++; }
 
   lastRowIndex=r;
   // make sure denominator below does not go to zero.
 
-  Span = Data[r][1] - Data[r-1][1];
+  Span = data[2*r+1] - data[2*(r-1)+1];
   if (Span != 0.0) {
-    Factor = (tableKey - Data[r-1][1]) / Span;
+    Factor = (tableKey - data[2*(r-1)+1]) / Span;
     if (Factor > 1.0) Factor = 1.0;
   } else {
     Factor = 1.0;
@@ -560,6 +687,7 @@ void FGTable::operator<<(istream& in_stream)
 {
   int startRow=0;
   int startCol=0;
+  double* data = GetWritableData();
 
 // In 1D table, no pseudo-row of column-headers (i.e. keys):
   if (Type == tt1D) startRow = 1;
@@ -567,7 +695,7 @@ void FGTable::operator<<(istream& in_stream)
   for (unsigned int r=startRow; r<=nRows; r++) {
     for (unsigned int c=startCol; c<=nCols; c++) {
       if (r != 0 || c != 0) {
-        in_stream >> Data[r][c];
+        in_stream >> data[r*(nCols+1)+c];
       }
     }
   }
@@ -575,11 +703,28 @@ void FGTable::operator<<(istream& in_stream)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+// Same as operator<<(istream&) for the data converted to numbers by the XML
+// parser: the missing values are left to zero and the extra values ignored.
+void FGTable::ReadData(const vector<double>& values)
+{
+  auto value = values.begin();
+  double* data = GetWritableData();
+
+  for (unsigned int r=(Type == tt1D ? 1 : 0); r<=nRows; r++) {
+    for (unsigned int c=0; c<=nCols; c++) {
+      if (value == values.end()) return;
+      if (r != 0 || c != 0) data[r*(nCols+1)+c] = *value++;
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 // Put some error handling in here if trying to access out of range row, col.
 
 FGTable& FGTable::operator<<(const double n)
 {
-  Data[rowCounter][colCounter] = n;
+  GetWritableData()[rowCounter*(nCols+1)+colCounter] = n;
   if (colCounter == (int)nCols) {
     colCounter = 0;
     rowCounter++;
@@ -621,7 +766,7 @@ void FGTable::Print(void)
       if (r == 0 && c == 0) {
         cout << "	";
       } else {
-        cout << Data[r][c] << "	";
+        cout << GetElement(r, c) << "	";
         if (Type == tt3D) {
           cout << endl;
           Tables[r-1]->Print();
@@ -38,6 +38,9 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <memory>
+#include <vector>
+
 #include "FGParameter.h"
 #include "math/FGPropertyValue.h"
 
@@ -223,6 +226,14 @@ referring to combustion efficiency). Later on, the table is used like this:
 combustion_efficiency = Lookup_Combustion_Efficiency->GetValue(equivalence_ratio);
 @endcode
 
+The breakpoints and values of the tables read from XML are immutable once the
+table is built and are shared between all the tables of the process that have
+the same content. Several executives running the same aircraft therefore use a
+single copy of the data: only the lookup hints are specific to each table.
+Copies of a table read from XML also share its data: a table modified with
+operator<<() gets its own copy of the data first. GetMemoryUsage() reports the
+memory used by the shared data.
+
 @author Jon S. Berndt
 */
 
@@ -259,6 +270,7 @@ public:
   FGTable (int );
   FGTable (int, int);
   double GetValue(void) const;
+  bool GetDependencies(std::vector<const FGPropertyNode*>& nodes) const override;
   double GetValue(double key) const;
   double GetValue(double rowKey, double colKey) const;
   double GetValue(double rowKey, double colKey, double TableKey) const;
@@ -287,7 +299,8 @@ public:
   void operator<<(std::istream&);
   FGTable& operator<<(const double n);
 
-  inline double GetElement(int r, int c) const {return Data[r][c];}
+  inline double GetElement(int r, int c) const
+  { return (*Data)[r*(nCols+1)+c]; }
 
   double operator()(unsigned int r, unsigned int c) const
   { return GetElement(r, c); }
@@ -298,23 +311,46 @@ public:
   { lookupProperty[eColumn] = new FGPropertyValue(node); }
 
   unsigned int GetNumRows() const {return nRows;}
+  unsigned int GetNumColumns() const {return nCols;}
 
   void Print(void);
 
   std::string GetName(void) const {return Name;}
 
+  /// Memory used by the data shared between the tables read from XML.
+  struct MemoryUsage {
+    /// Number of distinct data buffers.
+    size_t buffers;
+    /// Number of tables that use these buffers.
+    size_t tables;
+    /// Memory used by the buffers, in bytes.
+    size_t bytes;
+    /// Memory that the tables would use without sharing, in bytes.
+    size_t unsharedBytes;
+  };
+
+  /// Returns the memory used by the data of the tables read from XML.
+  static MemoryUsage GetMemoryUsage(void);
+
 private:
   enum type {tt1D, tt2D, tt3D} Type;
   enum axis {eRow=0, eColumn, eTable};
   bool internal;
   std::shared_ptr<FGPropertyManager> PropertyManager; // Property root used to do late binding.
   FGPropertyValue_ptr lookupProperty[3];
-  double** Data;
+  // Breakpoints and values stored row by row in (nRows+1)*(nCols+1) elements.
+  // The data is never modified once shared with other tables.
+  std::shared_ptr<const std::vector<double>> Data;
+  // Same buffer as Data while it is owned by this table only, null otherwise.
+  std::shared_ptr<std::vector<double>> WritableData;
   std::vector <FGTable*> Tables;
   unsigned int nRows, nCols;
   int colCounter, rowCounter;
   mutable int lastRowIndex, lastColumnIndex;
-  double** Allocate(void);
+  void Allocate(void);
+  double* GetWritableData(void);
+  void Intern(void);
+  void ReadData(const std::vector<double>& values);
   std::string Name;
   void bind(Element* el, const std::string& Prefix);
   void Debug(int from);
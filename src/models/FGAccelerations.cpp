@@ -121,6 +121,27 @@ bool FGAccelerations::Run(bool Holding)
   return false;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAccelerations::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  // The Lagrange multipliers are owned by the ground reactions of each
+  // executive.
+  auto& accelerations = static_cast<const FGAccelerations&>(source);
+  std::vector<LagrangeMultiplier*>* multipliers = in.MultipliersList;
+  in = accelerations.in;
+  in.MultipliersList = multipliers;
+  vPQRdot = accelerations.vPQRdot;
+  vPQRidot = accelerations.vPQRidot;
+  vUVWdot = accelerations.vUVWdot;
+  vUVWidot = accelerations.vUVWidot;
+  vBodyAccel = accelerations.vBodyAccel;
+  vFrictionForces = accelerations.vFrictionForces;
+  vFrictionMoments = accelerations.vFrictionMoments;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Compute body frame rotational accelerations based on the current body moments
 //
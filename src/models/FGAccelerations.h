@@ -114,6 +114,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void CopyState(const FGModel& source) override;
 
   /** Retrieves the body axis acceleration.
       Retrieves the computed body axis accelerations based on the
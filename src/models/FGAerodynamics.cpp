@@ -317,6 +317,43 @@ bool FGAerodynamics::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGAerodynamics::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& aerodynamics = static_cast<const FGAerodynamics&>(source);
+  in = aerodynamics.in;
+  Ts2b = aerodynamics.Ts2b;
+  Tb2s = aerodynamics.Tb2s;
+  vFnative = aerodynamics.vFnative;
+  vFw = aerodynamics.vFw;
+  vForces = aerodynamics.vForces;
+  vFnativeAtCG = aerodynamics.vFnativeAtCG;
+  vForcesAtCG = aerodynamics.vForcesAtCG;
+  vMoments = aerodynamics.vMoments;
+  vMomentsMRC = aerodynamics.vMomentsMRC;
+  vMomentsMRCBodyXYZ = aerodynamics.vMomentsMRCBodyXYZ;
+  vDXYZcg = aerodynamics.vDXYZcg;
+  vDeltaRP = aerodynamics.vDeltaRP;
+  impending_stall = aerodynamics.impending_stall;
+  stall_hyst = aerodynamics.stall_hyst;
+  bi2vel = aerodynamics.bi2vel;
+  ci2vel = aerodynamics.ci2vel;
+  alphaw = aerodynamics.alphaw;
+  clsq = aerodynamics.clsq;
+  lod = aerodynamics.lod;
+  qbar_area = aerodynamics.qbar_area;
+
+  for (unsigned int i=0; i<6; i++) {
+    for (unsigned int j=0; j<AeroFunctions[i].size(); j++)
+      AeroFunctions[i][j]->CopyCachedValue(*aerodynamics.AeroFunctions[i][j]);
+    for (unsigned int j=0; j<AeroFunctionsAtCG[i].size(); j++)
+      AeroFunctionsAtCG[i][j]->CopyCachedValue(*aerodynamics.AeroFunctionsAtCG[i][j]);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 FGColumnVector3 FGAerodynamics::GetForcesInStabilityAxes(void) const
 {
   FGColumnVector3 vFs = Tb2s*vForces;
@@ -113,6 +113,22 @@ bool FGAircraft::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGAircraft::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& aircraft = static_cast<const FGAircraft&>(source);
+  in = aircraft.in;
+  vForces = aircraft.vForces;
+  vMoments = aircraft.vMoments;
+  vXYZrp = aircraft.vXYZrp;
+  vXYZvrp = aircraft.vXYZvrp;
+  vXYZep = aircraft.vXYZep;
+  vDXYZcg = aircraft.vDXYZcg;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGAircraft::Load(Element* el)
 {
   string element_name;
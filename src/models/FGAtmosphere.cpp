@@ -104,6 +104,28 @@ bool FGAtmosphere::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGAtmosphere::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& atmosphere = static_cast<const FGAtmosphere&>(source);
+  in = atmosphere.in;
+  SLtemperature = atmosphere.SLtemperature;
+  SLdensity = atmosphere.SLdensity;
+  SLpressure = atmosphere.SLpressure;
+  SLsoundspeed = atmosphere.SLsoundspeed;
+  Temperature = atmosphere.Temperature;
+  Density = atmosphere.Density;
+  Pressure = atmosphere.Pressure;
+  Soundspeed = atmosphere.Soundspeed;
+  PressureAltitude = atmosphere.PressureAltitude;
+  DensityAltitude = atmosphere.DensityAltitude;
+  Viscosity = atmosphere.Viscosity;
+  KinematicViscosity = atmosphere.KinematicViscosity;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGAtmosphere::Calculate(double altitude)
 {
   FGPropertyNode* node = PropertyManager->GetNode();
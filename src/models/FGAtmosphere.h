@@ -96,6 +96,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void CopyState(const FGModel& source) override;
 
   bool InitModel(void) override;
 
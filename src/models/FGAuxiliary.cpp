@@ -228,6 +228,40 @@ bool FGAuxiliary::Run(bool Holding)
   return false;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAuxiliary::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& auxiliary = static_cast<const FGAuxiliary&>(source);
+  in = auxiliary.in;
+  vcas = auxiliary.vcas; veas = auxiliary.veas;
+  pt = auxiliary.pt; tat = auxiliary.tat; tatc = auxiliary.tatc;
+  mTw2b = auxiliary.mTw2b;
+  mTb2w = auxiliary.mTb2w;
+  vPilotAccel = auxiliary.vPilotAccel;
+  vPilotAccelN = auxiliary.vPilotAccelN;
+  vNcg = auxiliary.vNcg;
+  vNwcg = auxiliary.vNwcg;
+  vAeroPQR = auxiliary.vAeroPQR;
+  vAeroUVW = auxiliary.vAeroUVW;
+  vEulerRates = auxiliary.vEulerRates;
+  vMachUVW = auxiliary.vMachUVW;
+  vLocationVRP = auxiliary.vLocationVRP;
+  Vt = auxiliary.Vt; Vground = auxiliary.Vground;
+  Mach = auxiliary.Mach; MachU = auxiliary.MachU;
+  qbar = auxiliary.qbar; qbarUW = auxiliary.qbarUW; qbarUV = auxiliary.qbarUV;
+  Re = auxiliary.Re;
+  alpha = auxiliary.alpha; beta = auxiliary.beta;
+  adot = auxiliary.adot; bdot = auxiliary.bdot;
+  psigt = auxiliary.psigt; gamma = auxiliary.gamma;
+  Nx = auxiliary.Nx; Ny = auxiliary.Ny; Nz = auxiliary.Nz;
+  seconds_in_day = auxiliary.seconds_in_day;
+  day_of_year = auxiliary.day_of_year;
+  hoverbcg = auxiliary.hoverbcg; hoverbmac = auxiliary.hoverbmac;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 // From Stevens and Lewis, "Aircraft Control and Simulation", 3rd Ed., the
@@ -110,6 +110,21 @@ bool FGBuoyantForces::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGBuoyantForces::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& buoyantForces = static_cast<const FGBuoyantForces&>(source);
+  in = buoyantForces.in;
+  vTotalForces = buoyantForces.vTotalForces;
+  vTotalMoments = buoyantForces.vTotalMoments;
+
+  for (unsigned int i=0; i < Cells.size(); i++)
+    Cells[i]->CopyState(*buoyantForces.Cells[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGBuoyantForces::Load(Element *document)
 {
   Element *gas_cell_element;
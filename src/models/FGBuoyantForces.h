@@ -115,6 +115,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void CopyState(const FGModel& source) override;
 
   /** Loads the Buoyant forces model.
       The Load function for this class expects the XML parser to
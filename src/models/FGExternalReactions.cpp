@@ -134,6 +134,20 @@ bool FGExternalReactions::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGExternalReactions::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& reactions = static_cast<const FGExternalReactions&>(source);
+  vTotalForces = reactions.vTotalForces;
+  vTotalMoments = reactions.vTotalMoments;
+
+  for (unsigned int i=0; i < Forces.size(); i++)
+    Forces[i]->CopyState(*reactions.Forces[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGExternalReactions::bind(void)
 {
   typedef double (FGExternalReactions::*PMF)(int) const;
@@ -38,6 +38,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <iomanip>
+#include <map>
 
 #include "FGFCS.h"
 #include "input_output/FGModelLoader.h"
@@ -58,6 +59,7 @@ INCLUDES
 #include "models/flight_control/FGAngles.h"
 #include "models/flight_control/FGDistributor.h"
 #include "models/flight_control/FGLinearActuator.h"
+#include "models/flight_control/FGDelay.h"
 
 #include "FGFCSChannel.h"
 
@@ -69,7 +71,7 @@ namespace JSBSim {
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-FGFCS::FGFCS(FGFDMExec* fdm) : FGModel(fdm), ChannelRate(1)
+FGFCS::FGFCS(FGFDMExec* fdm) : FGModel(fdm), ChannelRate(1), ChannelSubSteps(1)
 {
   int i;
   Name = "FGFCS";
@@ -168,9 +170,13 @@ bool FGFCS::Run(bool Holding)
   for (i=0; i<SystemChannels.size(); i++) {
     if (debug_lvl & 4) cout << "    Executing System Channel: " << SystemChannels[i]->GetName() << endl;
     ChannelRate = SystemChannels[i]->GetRate();
+    ChannelSubSteps = SystemChannels[i]->GetSubSteps();
+    FGProfiler::Scope scope(FDMExec->GetProfiler(),
+                            SystemChannels[i]->GetProfileSection());
     SystemChannels[i]->Execute();
   }
   ChannelRate = 1;
+  ChannelSubSteps = 1;
 
   RunPostFunctions();
 
@@ -179,6 +185,40 @@ bool FGFCS::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFCS::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& fcs = static_cast<const FGFCS&>(source);
+  DaCmd = fcs.DaCmd; DeCmd = fcs.DeCmd; DrCmd = fcs.DrCmd;
+  DfCmd = fcs.DfCmd; DsbCmd = fcs.DsbCmd; DspCmd = fcs.DspCmd;
+  PTrimCmd = fcs.PTrimCmd; YTrimCmd = fcs.YTrimCmd; RTrimCmd = fcs.RTrimCmd;
+
+  for (int i=0; i<NForms; i++) {
+    DePos[i] = fcs.DePos[i]; DaLPos[i] = fcs.DaLPos[i];
+    DaRPos[i] = fcs.DaRPos[i]; DrPos[i] = fcs.DrPos[i];
+    DfPos[i] = fcs.DfPos[i]; DsbPos[i] = fcs.DsbPos[i];
+    DspPos[i] = fcs.DspPos[i];
+  }
+
+  ThrottleCmd = fcs.ThrottleCmd;
+  ThrottlePos = fcs.ThrottlePos;
+  MixtureCmd = fcs.MixtureCmd;
+  MixturePos = fcs.MixturePos;
+  PropAdvanceCmd = fcs.PropAdvanceCmd;
+  PropAdvance = fcs.PropAdvance;
+  PropFeatherCmd = fcs.PropFeatherCmd;
+  PropFeather = fcs.PropFeather;
+  BrakePos = fcs.BrakePos;
+  GearCmd = fcs.GearCmd; GearPos = fcs.GearPos;
+  TailhookPos = fcs.TailhookPos; WingFoldPos = fcs.WingFoldPos;
+
+  for (unsigned int i=0; i<SystemChannels.size(); i++)
+    SystemChannels[i]->CopyState(*fcs.SystemChannels[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFCS::SetDaLPos( int form , double pos )
 {
   switch(form) {
@@ -503,6 +543,29 @@ bool FGFCS::Load(Element* document)
     else
       ChannelRate = 1;
 
+    if (!channel_element->GetAttributeValue("substeps").empty())
+      ChannelSubSteps = channel_element->GetAttributeValueAsNumber("substeps");
+    else
+      ChannelSubSteps = 1;
+
+    if (ChannelSubSteps < 1) {
+      cerr << channel_element->ReadFrom() << highint << fgred
+           << "The number of sub-steps of channel " << sChannelName
+           << " must be a positive integer. It is set to 1." << reset << endl;
+      ChannelSubSteps = 1;
+    }
+
+    string sOrder = channel_element->GetAttributeValue("order");
+    if (sOrder.empty())
+      sOrder = document->GetAttributeValue("order");
+    if (!sOrder.empty() && sOrder != "declaration" && sOrder != "dependencies") {
+      cerr << channel_element->ReadFrom() << highint << fgred
+           << "Unknown order \"" << sOrder << "\" for channel " << sChannelName
+           << ". The components are executed in their declaration order."
+           << reset << endl;
+      sOrder = "declaration";
+    }
+
     if (sOnOffProperty.length() > 0) {
       FGPropertyNode* OnOffPropertyNode = PropertyManager->GetNode(sOnOffProperty);
       if (OnOffPropertyNode == 0) {
@@ -513,10 +576,15 @@ bool FGFCS::Load(Element* document)
         throw("Bad system definition");
       } else
         newChannel = new FGFCSChannel(this, sChannelName, ChannelRate,
-                                      OnOffPropertyNode);
+                                      OnOffPropertyNode, ChannelSubSteps);
     } else
-      newChannel = new FGFCSChannel(this, sChannelName, ChannelRate);
+      newChannel = new FGFCSChannel(this, sChannelName, ChannelRate, nullptr,
+                                    ChannelSubSteps);
 
+    newChannel->SetProfileSection(FDMExec->GetProfiler()->Register(
+      FGProfiler::eChannel,
+      document->GetAttributeValue("name") + "/" + sChannelName));
+    newChannel->SetSortComponents(sOrder == "dependencies");
     SystemChannels.push_back(newChannel);
 
     if (debug_lvl > 0)
@@ -581,6 +649,8 @@ bool FGFCS::Load(Element* document)
           newChannel->Add(new FGDistributor(this, component_element));
         } else if (component_element->GetName() == string("linear_actuator")) {
           newChannel->Add(new FGLinearActuator(this, component_element));
+        } else if (component_element->GetName() == string("delay")) {
+          newChannel->Add(new FGDelay(this, component_element));
         } else {
           cerr << "Unknown FCS component: " << component_element->GetName() << endl;
         }
@@ -601,6 +671,169 @@ bool FGFCS::Load(Element* document)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFCS::AnalyzeDependencies(void)
+{
+  // Resolve the properties read by the <input> elements of the components.
+  // Properties that do not exist yet are bound later and are stored as null
+  // pointers.
+  map<const FGFCSComponent*, vector<const FGPropertyNode*> > inputs;
+  map<const FGPropertyNode*, vector<const FGFCSComponent*> > writers;
+
+  for (auto channel: SystemChannels) {
+    for (unsigned int i=0; i<channel->GetNumComponents(); i++) {
+      const FGFCSComponent* comp = channel->GetComponent(i);
+      vector<const FGPropertyNode*>& nodes = inputs[comp];
+      for (auto& input: comp->GetInputNodes())
+        nodes.push_back(PropertyManager->GetNode(input->GetFullyQualifiedName()));
+      for (auto& output: comp->GetOutputNodes())
+        writers[output].push_back(comp);
+    }
+  }
+
+  // Sort the components of the channels that requested it. The components
+  // that read properties which are not listed by their <input> elements are
+  // not moved: they split the channel in segments that are sorted
+  // independently.
+  for (auto channel: SystemChannels) {
+    if (!channel->GetSortComponents()) continue;
+
+    size_t n = channel->GetNumComponents();
+    vector<size_t> order;
+    size_t start = 0;
+
+    while (start < n) {
+      size_t end = start;
+      while (end < n && !channel->GetComponent(end)->HasUnlistedInputs()) ++end;
+
+      // Kahn's algorithm over the segment [start, end[. The components that
+      // are ready are picked in their declaration order so that the
+      // components which do not depend on each other keep their order.
+      size_t size = end - start;
+      vector<vector<size_t> > successors(size);
+      vector<unsigned int> predecessors(size, 0);
+
+      for (size_t i=0; i<size; i++) {
+        FGFCSComponent* comp = channel->GetComponent(start+i);
+        for (size_t j=0; j<size; j++) {
+          if (i == j) continue;
+          FGFCSComponent* other = channel->GetComponent(start+j);
+          bool depends = false;
+          for (auto node: inputs[comp])
+            for (auto& output: other->GetOutputNodes())
+              if (node == output) depends = true;
+          // Two components writing the same property keep their order.
+          if (j < i)
+            for (auto& output: comp->GetOutputNodes())
+              for (auto& other_output: other->GetOutputNodes())
+                if (output == other_output) depends = true;
+          if (depends) {
+            successors[j].push_back(i);
+            predecessors[i]++;
+          }
+        }
+      }
+
+      vector<bool> done(size, false);
+      for (size_t count=0; count<size; count++) {
+        size_t next = size;
+        for (size_t i=0; i<size; i++) {
+          if (!done[i] && predecessors[i] == 0) {
+            next = i;
+            break;
+          }
+        }
+
+        if (next == size) {
+          // The remaining components form at least one cycle: they are
+          // executed in their declaration order.
+          cerr << highint << fgred << "Channel " << channel->GetName()
+               << ": the following components form a dependency cycle and are"
+               << " executed in their declaration order:" << reset << endl;
+          for (size_t i=0; i<size; i++) {
+            if (done[i]) continue;
+            cerr << "    " << channel->GetComponent(start+i)->GetName() << endl;
+            order.push_back(start+i);
+          }
+          break;
+        }
+
+        done[next] = true;
+        order.push_back(start+next);
+        for (size_t i: successors[next]) predecessors[i]--;
+      }
+
+      if (end < n) order.push_back(end);
+      start = end + 1;
+    }
+
+    channel->Reorder(order);
+  }
+
+  // Locate the components now that the channels are sorted.
+  map<const FGFCSComponent*, pair<size_t, size_t> > position;
+  for (size_t c=0; c<SystemChannels.size(); c++) {
+    FGFCSChannel* channel = SystemChannels[c];
+    for (unsigned int i=0; i<channel->GetNumComponents(); i++)
+      position[channel->GetComponent(i)] = make_pair(c, i);
+  }
+
+  // Report the components that read a property before it is computed (i.e.
+  // with a delay of one frame) and find the channels that can skip their
+  // execution when their inputs are unchanged.
+  for (size_t c=0; c<SystemChannels.size(); c++) {
+    FGFCSChannel* channel = SystemChannels[c];
+    bool report = channel->GetSortComponents() ? debug_lvl > 0
+                                               : (debug_lvl & 16) != 0;
+    bool skippable = channel->GetNumComponents() > 0;
+    vector<FGConstPropertyNode_ptr> watched;
+
+    for (unsigned int i=0; i<channel->GetNumComponents(); i++) {
+      const FGFCSComponent* comp = channel->GetComponent(i);
+      if (!comp->IsStateless()) skippable = false;
+
+      for (auto node: inputs[comp]) {
+        if (!node) {
+          skippable = false;
+          continue;
+        }
+
+        watched.push_back(node);
+
+        for (auto writer: writers[node]) {
+          pair<size_t, size_t> pos = position[writer];
+          if (pos.first < c || (pos.first == c && pos.second < i)) continue;
+
+          if (pos.first == c) skippable = false;
+          if (report)
+            cout << "    Component " << comp->GetName() << " (channel "
+                 << channel->GetName() << ") reads " << node->GetFullyQualifiedName()
+                 << " before it is computed by " << writer->GetName()
+                 << " (channel " << SystemChannels[pos.first]->GetName()
+                 << "): its value is delayed by one frame." << endl;
+        }
+      }
+
+      for (auto& output: comp->GetOutputNodes())
+        watched.push_back(output.ptr());
+    }
+
+    if (skippable) {
+      channel->SetWatchedNodes(watched);
+      if (report)
+        cout << "    Channel " << channel->GetName() << " is only executed when"
+             << " its inputs change." << endl;
+    }
+
+    unsigned int compiled = channel->Compile();
+    if (report)
+      cout << "    Channel " << channel->GetName() << ": " << compiled << " of "
+           << channel->GetNumComponents() << " components are compiled ("
+           << channel->GetNumBanks() << " banks)." << endl;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGFCS::GetBrake(FGLGear::BrakeGroup bg)
 {
   return BrakePos[bg];
@@ -687,7 +920,7 @@ void FGFCS::AddThrottle(void)
 
 double FGFCS::GetDt(void) const
 {
-  return FDMExec->GetDeltaT()*rate;
+  return GetStepDeltaT(FDMExec->GetDeltaT());
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -119,6 +119,38 @@ CLASS DOCUMENTATION
 
     In this case, the FCS would be read in from another file.
 
+    <h2>Execution order</h2>
+    The channels are executed in the order in which they are declared and, by
+    default, so are the components of each channel. A component that reads the
+    output of a component declared after it therefore gets the value computed
+    during the previous frame. The attribute <tt>order="dependencies"</tt> of a
+    \<channel> element (or of the \<system>, \<autopilot> and
+    \<flight_control> elements for all their channels) requests the components
+    to be executed after the components that compute their inputs:
+
+    @code
+    <system name="autothrottle" order="dependencies">
+      <channel name="speed hold">
+        ...
+      </channel>
+    </system>
+    @endcode
+
+    Only the properties listed by the \<input> elements are taken into account
+    so the components that also read other properties (e.g. a \<switch> or an
+    \<fcs_function>) are never moved. The dependency cycles and the one frame
+    delays that remain are reported when the aircraft is loaded. Finally the
+    channels that are only made of gains, summers and deadbands with constant
+    parameters are not executed when their inputs did not change.
+
+    Once sorted, the channels are compiled into a pipeline (see FGFCSPipeline)
+    where the gains, summers, deadbands, filters and actuators with constant
+    parameters are evaluated in a flat loop over contiguous arrays instead of
+    calling the Run() method of each component. Consecutive filters of the
+    same type and consecutive actuators are stepped together in banks, so a
+    channel that lists all its actuators one after the other is executed
+    faster. The results are unchanged.
+
     <h2>Properties</h2>
     @property fcs/aileron-cmd-norm normalized aileron command
     @property fcs/elevator-cmd-norm normalized elevator command
@@ -179,6 +211,7 @@ CLASS DOCUMENTATION
     @see FGFCSComponent
     @see Element
     @see FGDistributor
+    @see FGDelay
 */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -205,6 +238,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void CopyState(const FGModel& source) override;
 
   /// @name Pilot input command retrieval
   //@{
@@ -539,6 +573,14 @@ public:
       @return true if succesful */
   bool Load(Element* el) override;
 
+  /** Analyzes the dependencies between the components of all the channels.
+      The components of the channels with the attribute order="dependencies"
+      are sorted, the one frame delays are reported, the channels that can
+      be skipped when their inputs are unchanged are identified and the
+      channels are compiled (see FGFCSPipeline). It is called from FGFDMExec
+      once the whole aircraft is loaded. */
+  void AnalyzeDependencies(void);
+
   SGPath FindFullPathName(const SGPath& path) const override;
 
   void AddThrottle(void);
@@ -547,7 +589,8 @@ public:
   std::shared_ptr<FGPropertyManager> GetPropertyManager(void) { return PropertyManager; }
 
   bool GetTrimStatus(void) const { return FDMExec->GetTrimStatus(); }
-  double GetChannelDeltaT(void) const { return GetDt() * ChannelRate; }
+  double GetChannelDeltaT(void) const
+  { return GetDt() * ChannelRate / ChannelSubSteps; }
 
 private:
   double DaCmd, DeCmd, DrCmd, DfCmd, DsbCmd, DspCmd;
@@ -568,6 +611,7 @@ private:
   double TailhookPos, WingFoldPos;
   SystemType systype;
   int ChannelRate;
+  int ChannelSubSteps;
   FGFDMExec* fdmex;
 
   typedef std::vector <FGFCSChannel*> Channels;
@@ -39,6 +39,10 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <iostream>
+#include <memory>
+#include <vector>
+
+#include "flight_control/FGFCSPipeline.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -55,12 +59,20 @@ CLASS DOCUMENTATION
       element. Channels are a way to group sets of components that perform
       a specific purpose or algorithm. 
       Created within a <system> tag, the channel is defined as follows
-      <channel name="name" [execute="property"] [execrate="rate"]>
+      <channel name="name" [execute="property"] [execrate="rate"] [substeps="number"]>
       name is the name of the channel - in the old way this would also be used to bind elements
       execute [optional] is the property that defines when to execute this channel; an on/off switch
       execrate [optional] is the rate at which the channel should execute. 
                A value of 0 or 1 will execute the channel every frame, a value of 2
                every other frame (half rate), a value of 4 is every 4th frame (quarter rate)
+      substeps [optional] is the number of times the components of the channel are
+               executed each time the channel runs. The components then see a time step
+               of execrate*dt/substeps which allows to integrate stiff components such as
+               actuators at a higher rate than the simulation frame rate.
+      order [optional] is either "declaration" (the default) or "dependencies".
+               In the latter case, the components are executed in an order
+               such that each component runs after the components that
+               produce its inputs (see FGFCS::AnalyzeDependencies).
       */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -73,10 +85,12 @@ class FGFCSChannel {
 public:
   /// Constructor
   FGFCSChannel(FGFCS* FCS, const std::string &name, int execRate,
-               FGPropertyNode* node=0)
-    : fcs(FCS), OnOffNode(node), Name(name)
+               FGPropertyNode* node=0, int subSteps=1)
+    : fcs(FCS), OnOffNode(node), Name(name), ProfileSection(-1),
+      SortComponents(false), WatchedValid(false)
   {
     ExecRate = execRate < 1 ? 1 : execRate;
+    SubSteps = subSteps < 1 ? 1 : subSteps;
     // Set ExecFrameCountSinceLastRun so that each components are initialized
     ExecFrameCountSinceLastRun = ExecRate;
   }
@@ -109,9 +123,23 @@ public:
     for (unsigned int i=0; i<FCSComponents.size(); i++)
       FCSComponents[i]->ResetPastStates();
 
+    if (Pipeline) Pipeline->ResetPastStates();
+
     // Set ExecFrameCountSinceLastRun so that each components are initialized
     // after a reset.
     ExecFrameCountSinceLastRun = ExecRate;
+    WatchedValid = false;
+  }
+  /// Copies the state of a channel built from the same definition.
+  void CopyState(const FGFCSChannel& source) {
+    for (unsigned int i=0; i<FCSComponents.size(); i++)
+      FCSComponents[i]->CopyState(*source.FCSComponents[i]);
+
+    if (Pipeline) Pipeline->CopyState(*source.Pipeline);
+
+    ExecFrameCountSinceLastRun = source.ExecFrameCountSinceLastRun;
+    WatchedValues = source.WatchedValues;
+    WatchedValid = source.WatchedValid;
   }
   /// Executes all the components in a channel.
   void Execute() {
@@ -131,12 +159,76 @@ public:
     // channel will be run at rate 1 if trimming, or when the next execrate
     // frame is reached
     if (fcs->GetTrimStatus() || ExecFrameCountSinceLastRun >= ExecRate) {
-      for (unsigned int i=0; i<FCSComponents.size(); i++) 
-        FCSComponents[i]->Run();
+      if (!WatchedNodes.empty()) {
+        if (WatchedValid && !WatchedNodesChanged()) return;
+        WatchedValid = true;
+      }
+
+      for (int step=0; step<SubSteps; step++) {
+        if (Pipeline)
+          Pipeline->Run();
+        else {
+          for (unsigned int i=0; i<FCSComponents.size(); i++)
+            FCSComponents[i]->Run();
+        }
+      }
+
+      for (unsigned int i=0; i<WatchedNodes.size(); i++)
+        WatchedValues[i] = WatchedNodes[i]->getDoubleValue();
     }
   }
   /// Get the channel rate
   int GetRate(void) const { return ExecRate; }
+  /// Get the number of sub-steps executed each time the channel runs
+  int GetSubSteps(void) const { return SubSteps; }
+  /// Set the profiler section that measures the execution of the channel
+  void SetProfileSection(int id) { ProfileSection = id; }
+  /// Get the profiler section of the channel (-1 if none)
+  int GetProfileSection(void) const { return ProfileSection; }
+  /// Request the components to be sorted according to their dependencies
+  void SetSortComponents(bool sort) { SortComponents = sort; }
+  /// Are the components sorted according to their dependencies ?
+  bool GetSortComponents(void) const { return SortComponents; }
+  /** Changes the execution order of the components.
+      @param order the indices of the components in their new execution order.
+             It must be a permutation of 0..GetNumComponents()-1. */
+  void Reorder(const std::vector<size_t>& order) {
+    FCSCompVec components;
+    for (size_t i: order) components.push_back(FCSComponents[i]);
+    FCSComponents = components;
+    Pipeline.reset();
+  }
+  /** Compiles the components of the channel into a pipeline (see
+      FGFCSPipeline). It must be called once the components are in their final
+      order. The compiled filters and actuators are grouped in banks.
+      @return the number of components that have been compiled. */
+  unsigned int Compile() {
+    Pipeline.reset(new FGFCSPipeline);
+    for (auto comp: FCSComponents) Pipeline->Add(comp);
+    Pipeline->BuildBanks();
+
+    unsigned int count = Pipeline->GetNumCompiled();
+    if (count == 0) Pipeline.reset();
+    return count;
+  }
+  /// Returns the number of banks of filters and actuators.
+  unsigned int GetNumBanks() const {
+    return Pipeline ? Pipeline->GetNumBanks() : 0;
+  }
+  /** Sets the properties that are watched to decide if the channel needs to
+      be executed. When the list is not empty, the channel is skipped if none
+      of these properties have changed since the last time it was executed.
+      The list must therefore include all the inputs of the channel as well as
+      its outputs (so that an output overwritten by another model is
+      restored). It must only be set for channels whose components are
+      stateless. */
+  void SetWatchedNodes(const std::vector<FGConstPropertyNode_ptr>& nodes) {
+    WatchedNodes = nodes;
+    WatchedValues.assign(nodes.size(), 0.0);
+    WatchedValid = false;
+  }
+  /// Can the execution of the channel be skipped when its inputs are unchanged ?
+  bool IsSkippable(void) const { return !WatchedNodes.empty(); }
 
   private:
     FGFCS* fcs;
@@ -145,7 +237,20 @@ public:
     std::string Name;
 
     int ExecRate;        // rate at which this system executes, 0 or 1 every frame, 2 every second frame etc..
+    int SubSteps;        // number of times the components are executed each time the channel runs
     int ExecFrameCountSinceLastRun;
+    int ProfileSection;  // profiler section identifier
+    bool SortComponents; // execute the components in the order of their dependencies
+    std::vector<FGConstPropertyNode_ptr> WatchedNodes;
+    std::vector<double> WatchedValues; // values of WatchedNodes after the last execution
+    bool WatchedValid;   // are WatchedValues up to date ?
+    std::unique_ptr<FGFCSPipeline> Pipeline; // compiled components
+
+    bool WatchedNodesChanged(void) const {
+      for (unsigned int i=0; i<WatchedNodes.size(); i++)
+        if (WatchedNodes[i]->getDoubleValue() != WatchedValues[i]) return true;
+      return false;
+    }
 };
 
 }
@@ -423,6 +423,28 @@ void FGGasCell::Calculate(double dt)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGasCell::CopyState(const FGForce& source)
+{
+  FGForce::CopyState(source);
+
+  auto& cell = static_cast<const FGGasCell&>(source);
+  Pressure = cell.Pressure;
+  Contents = cell.Contents;
+  Volume = cell.Volume;
+  dVolumeIdeal = cell.dVolumeIdeal;
+  Temperature = cell.Temperature;
+  Buoyancy = cell.Buoyancy;
+  ValveOpen = cell.ValveOpen;
+  Mass = cell.Mass;
+  gasCellJ = cell.gasCellJ;
+  gasCellM = cell.gasCellM;
+
+  for (unsigned int i=0; i < Ballonet.size(); i++)
+    Ballonet[i]->CopyState(*cell.Ballonet[i]);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -773,6 +795,19 @@ void FGBallonet::Calculate(double dt)
   ballonetJ += MassBalance->GetPointmassInertia(GetMass(), GetXYZ());
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBallonet::CopyState(const FGBallonet& source)
+{
+  Pressure = source.Pressure;
+  Contents = source.Contents;
+  Volume = source.Volume;
+  dVolumeIdeal = source.dVolumeIdeal;
+  dU = source.dU;
+  Temperature = source.Temperature;
+  ballonetJ = source.ballonetJ;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
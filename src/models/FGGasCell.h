@@ -184,6 +184,7 @@ public:
   /** Runs the gas cell model; called by BuoyantForces
    */
   void Calculate(double dt);
+  void CopyState(const FGForce& source) override;
 
   /** Get the index of this gas cell
       @return gas cell index. */
@@ -309,7 +310,9 @@ public:
   /** Runs the ballonet model; called by FGGasCell
    */
   void Calculate(double dt);
-
+  /** Copies the state of a ballonet (see FGFDMExec::Clone()).
+      @param source a ballonet built from the same definition. */
+  void CopyState(const FGBallonet& source);
 
   /** Get the center of gravity location of the ballonet
       @return CoG location in the structural frame in inches. */
@@ -40,6 +40,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGGroundReactions.h"
 #include "FGAccelerations.h"
+#include "FGInertial.h"
 #include "input_output/FGXMLElement.h"
 
 using namespace std;
@@ -95,13 +96,29 @@ bool FGGroundReactions::Run(bool Holding)
   multipliers.clear();
 
   // Sum forces and moments for all gear, here.
-  // Some optimizations may be made here - or rather in the gear code itself.
-  // The gear ::Run() method is called several times - once for each gear.
-  // Perhaps there is some commonality for things which only need to be
-  // calculated once.
-  for (auto& gear:lGear) {
-    vForces  += gear->GetBodyForces(this);
-    vMoments += gear->GetMoments();
+  if (IsWellAboveGround()) {
+    for (auto& gear:lGear) {
+      vForces  += gear->GetBodyForces(this, nullptr);
+      vMoments += gear->GetMoments();
+    }
+  }
+  else {
+    // Query the ground below all the gears that are down in a single call.
+    ContactLocations.clear();
+    for (auto& gear:lGear) {
+      if (gear->GetGearUnitDown())
+        ContactLocations.push_back(gear->GetContactLocation());
+    }
+
+    FDMExec->GetInertial()->GetContactPoints(ContactLocations, ContactPoints);
+
+    unsigned int i = 0;
+    for (auto& gear:lGear) {
+      const FGGroundCallback::ContactPoint* point = nullptr;
+      if (gear->GetGearUnitDown()) point = &ContactPoints[i++];
+      vForces  += gear->GetBodyForces(this, point);
+      vMoments += gear->GetMoments();
+    }
   }
 
   RunPostFunctions();
@@ -111,6 +128,47 @@ bool FGGroundReactions::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGGroundReactions::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  // The list of the Lagrange multipliers is rebuilt each time the model is run.
+  auto& groundReactions = static_cast<const FGGroundReactions&>(source);
+  in = groundReactions.in;
+  vForces = groundReactions.vForces;
+  vMoments = groundReactions.vMoments;
+  DsCmd = groundReactions.DsCmd;
+  FGSurface::operator=(groundReactions);
+
+  for (unsigned int i=0; i < lGear.size(); i++)
+    lGear[i]->CopyState(*groundReactions.lGear[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGGroundReactions::IsWellAboveGround(void) const
+{
+  // Radius of the sphere centered on the CG that contains all the contact
+  // points.
+  double radius = 0.0;
+  for (auto& gear:lGear)
+    radius = max(radius, gear->GetBodyLocation().Magnitude());
+
+  // The ground callback bounds the terrain elevation below that sphere. The
+  // ground callbacks that can not (e.g. moving carrier decks) are always
+  // queried.
+  double hmax;
+  if (!FDMExec->GetInertial()->GetMaxTerrainElevation(in.Location, radius,
+                                                      hmax))
+    return false;
+
+  // The bumps of the surface are up to 0.4 ft high (see
+  // FGSurface::GetBumpHeight()).
+  return in.DistanceASL - radius > hmax + 0.4*bumpiness + 1.0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGGroundReactions::GetWOW(void) const
 {
   for (auto& gear:lGear) {
@@ -69,6 +69,13 @@ CLASS DOCUMENTATION
     </ground_reactions>
 @endcode   
 
+    The ground is queried for all the contact points at once (see
+    FGGroundCallback::GetAGLevels()). When the vehicle is well above the
+    terrain, that is when its altitude above ground exceeds twice the distance
+    between the CG and its farthest contact point, the ground is not queried at
+    all and the contact points are known to be free. This assumes that the
+    terrain slope below the vehicle does not exceed 45 degrees.
+
 
   */
 
@@ -90,6 +97,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void CopyState(const FGModel& source) override;
   bool Load(Element* el) override;
   const FGColumnVector3& GetForces(void) const {return vForces;}
   double GetForces(int idx) const {return vForces(idx);}
@@ -128,6 +136,13 @@ private:
   std::vector <LagrangeMultiplier*> multipliers;
   double DsCmd;
 
+  // Buffers of the batched ground queries, kept between frames to avoid
+  // reallocating them.
+  std::vector <FGLocation> ContactLocations;
+  std::vector <FGGroundCallback::ContactPoint> ContactPoints;
+
+  bool IsWellAboveGround(void) const;
+
   void bind(void);
   void Debug(int from) override;
 };
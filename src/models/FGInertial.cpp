@@ -116,6 +116,7 @@ bool FGInertial::Load(Element* el)
     J2 = el->FindElementValueAsNumber("J2"); // Dimensionless
 
   GroundCallback->SetEllipse(a, b);
+  GroundRevision++;
 
   // Messages to warn the user about possible inconsistencies.
   if (a != b && J2 == 0.0)
@@ -130,6 +131,28 @@ bool FGInertial::Load(Element* el)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGInertial::CopyPlanet(const FGInertial& inertial)
+{
+  vOmegaPlanet = inertial.vOmegaPlanet;
+  GM = inertial.GM;
+  J2 = inertial.J2;
+  a = inertial.a;
+  b = inertial.b;
+  gravType = inertial.gravType;
+
+  FGGroundCallback* gc = inertial.GroundCallback->Clone();
+
+  if (!gc) {
+    GroundCallback->SetEllipse(a, b);
+    GroundRevision++;
+    return false;
+  }
+
+  SetGroundCallback(gc);
+  return true;
+}
+
+
 bool FGInertial::Run(bool Holding)
 {
   // Fast return if we have nothing to do ...
@@ -154,6 +177,17 @@ bool FGInertial::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGInertial::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& inertial = static_cast<const FGInertial&>(source);
+  in = inertial.in;
+  vGravAccel = inertial.vGravAccel;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 FGMatrix33 FGInertial::GetTl2ec(const FGLocation& location) const
 {
   FGColumnVector3 North, Down, East{-location(eY), location(eX), 0.};
@@ -77,6 +77,7 @@ public:
                      on a socket for the "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void CopyState(const FGModel& source) override;
   static constexpr double GetStandardGravity(void) { return gAccelReference; }
   const FGColumnVector3& GetGravity(void) const {return vGravAccel;}
   const FGColumnVector3& GetOmegaPlanet() const {return vOmegaPlanet;}
@@ -108,6 +109,26 @@ public:
     return GroundCallback->GetAGLevel(location, contact, normal, velocity,
                                       ang_velocity); }
 
+  /** Get terrain contact points information below several locations.
+      @param locations Locations at which the contact points are evaluated.
+      @param contacts  Contact points information (resized to the number of
+                       locations).
+      @see GetContactPoint
+      @see FGGroundCallback::GetAGLevels */
+  void GetContactPoints(const std::vector<FGLocation>& locations,
+                        std::vector<FGGroundCallback::ContactPoint>& contacts) const
+  { GroundCallback->GetAGLevels(locations, contacts); }
+
+  /** Get an upper bound of the terrain elevation around a location.
+      @param location Center of the area.
+      @param radius   Horizontal radius of the area in feet.
+      @param hmax     Maximum terrain elevation within the area in feet.
+      @return false if the ground callback can not bound the elevation.
+      @see FGGroundCallback::GetMaxTerrainElevation */
+  bool GetMaxTerrainElevation(const FGLocation& location, double radius,
+                              double& hmax) const
+  { return GroundCallback->GetMaxTerrainElevation(location, radius, hmax); }
+
   /** Get the altitude above ground level.
       @return the altitude AGL in feet.
       @param location Location at which the AGL is evaluated.
@@ -130,6 +151,7 @@ public:
       @see SetGroundcallback */
   void SetTerrainElevation(double h) {
     GroundCallback->SetTerrainElevation(h);
+    GroundRevision++;
   }
 
   /** Set the simulation time.
@@ -139,7 +161,16 @@ public:
   */
   void SetTime(double time) {
     GroundCallback->SetTime(time);
+    GroundRevision++;
   }
+
+  /** Get the revision number of the ground.
+      The revision is incremented each time the ground callback, the terrain
+      elevation or the time are modified. Ground queries made at the same
+      location and the same revision return the same results and can therefore
+      be cached.
+  */
+  unsigned int GetGroundRevision(void) const { return GroundRevision; }
   ///@}
 
   /** Sets the ground callback pointer.
@@ -148,7 +179,18 @@ public:
       @param gc A pointer to a ground callback object
       @see FGGroundCallback
   */
-  void SetGroundCallback(FGGroundCallback* gc) { GroundCallback.reset(gc); }
+  void SetGroundCallback(FGGroundCallback* gc) {
+    GroundCallback.reset(gc);
+    GroundRevision++;
+  }
+
+  /** Copies the planet of another instance: its dimensions, its rotation
+      rate, its gravity model and its ground callback.
+      @param inertial the instance to copy the planet from.
+      @return false if the ground callback does not support copies (see
+              FGGroundCallback::Clone()), in which case the current ground
+              callback is kept. */
+  bool CopyPlanet(const FGInertial& inertial);
 
   /// These define the indices use to select the gravitation models.
   enum eGravType {
@@ -215,6 +257,7 @@ private:
   double b;    // WGS84 semiminor axis length in feet
   int gravType;
   std::unique_ptr<FGGroundCallback> GroundCallback;
+  unsigned int GroundRevision = 0;
 
   double GetGAccel(double r) const;
   FGColumnVector3 GetGravityJ2(const FGLocation& position) const;
@@ -279,7 +279,37 @@ void FGLGear::ResetToIC(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+FGLocation FGLGear::GetContactLocation(void) const
+{
+  FGColumnVector3 vWhlBodyVec = Ts2b * (vXYZn - in.vXYZcg);
+
+  return in.Location.LocalToLocation(in.Tb2l * vWhlBodyVec);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 const FGColumnVector3& FGLGear::GetBodyForces(FGSurface *surface)
+{
+  if (GetGearUnitDown()) {
+    FGGroundCallback::ContactPoint point;
+
+    // Compute the height of the theoretical location of the wheel (if strut is
+    // not compressed) with respect to the ground level
+    point.agl = fdmex->GetInertial()->GetContactPoint(GetContactLocation(),
+                                                      point.contact,
+                                                      point.normal,
+                                                      point.velocity,
+                                                      point.ang_velocity);
+    return GetBodyForces(surface, &point);
+  }
+
+  return GetBodyForces(surface, nullptr);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const FGColumnVector3& FGLGear::GetBodyForces(FGSurface *surface,
+                                 const FGGroundCallback::ContactPoint* point)
 {
   double gearPos = 1.0;
 
@@ -288,18 +318,19 @@ const FGColumnVector3& FGLGear::GetBodyForces(FGSurface *surface)
   if (isRetractable) gearPos = GetGearUnitPos();
 
   if (gearPos > 0.99) { // Gear DOWN
-    FGColumnVector3 normal, terrainVel, dummy;
-    FGLocation gearLoc, contact;
     FGColumnVector3 vWhlBodyVec = Ts2b * (vXYZn - in.vXYZcg);
 
     vLocalGear = in.Tb2l * vWhlBodyVec; // Get local frame wheel location
-    gearLoc = in.Location.LocalToLocation(vLocalGear);
 
-    // Compute the height of the theoretical location of the wheel (if strut is
-    // not compressed) with respect to the ground level
-    double height = fdmex->GetInertial()->GetContactPoint(gearLoc, contact,
-                                                          normal, terrainVel,
-                                                          dummy);
+    // Without a contact point, the gear is known to be well above the ground.
+    double height = HUGE_VAL;
+    FGColumnVector3 normal, terrainVel;
+
+    if (point) {
+      height = point->agl;
+      normal = point->normal;
+      terrainVel = point->velocity;
+    }
 
     // Does this surface contact point interact with another surface?
     if (surface) {
@@ -323,7 +354,7 @@ const FGColumnVector3& FGLGear::GetBodyForces(FGSurface *surface)
       // transform this height in actual compression of the strut (BOGEY) or in
       // the normal direction to the ground (STRUCTURE)
       double normalZ = (in.Tec2l*normal)(eZ);
-      LGearProj = -(mTGear.Transposed() * vGroundNormal)(eZ);
+      LGearProj = -mTGear.TransposedProduct(vGroundNormal)(eZ);
 
       // The following equations use the vector to the tire contact patch
       // including the strut compression.
@@ -351,13 +382,13 @@ const FGColumnVector3& FGLGear::GetBodyForces(FGSurface *surface)
       vActingXYZn = vXYZn + Tb2s * vWhlDisplVec;
       FGColumnVector3 vBodyWhlVel = in.PQR * vWhlContactVec;
       vBodyWhlVel += in.UVW - in.Tec2b * terrainVel;
-      vWhlVelVec = mTGear.Transposed() * vBodyWhlVel;
+      vWhlVelVec = mTGear.TransposedProduct(vBodyWhlVel);
 
       InitializeReporting();
       ComputeSteeringAngle();
       ComputeGroundFrame();
 
-      vGroundWhlVel = mT.Transposed() * vBodyWhlVel;
+      vGroundWhlVel = mT.TransposedProduct(vBodyWhlVel);
 
       if (fdmex->GetTrimStatus() || in.TotalDeltaT == 0.0)
         compressSpeed = 0.0; // Steady state is sought during trimming
@@ -423,6 +454,47 @@ const FGColumnVector3& FGLGear::GetBodyForces(FGSurface *surface)
   return FGForce::GetBodyForces();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLGear::CopyState(const FGForce& source)
+{
+  FGForce::CopyState(source);
+
+  auto& gear = static_cast<const FGLGear&>(source);
+  FGSurface::operator=(gear);
+  mTGear = gear.mTGear;
+  vLocalGear = gear.vLocalGear;
+  vWhlVelVec = gear.vWhlVelVec;
+  vGroundWhlVel = gear.vGroundWhlVel;
+  vGroundNormal = gear.vGroundNormal;
+  SteerAngle = gear.SteerAngle;
+  compressLength = gear.compressLength;
+  compressSpeed = gear.compressSpeed;
+  BrakeFCoeff = gear.BrakeFCoeff;
+  SinkRate = gear.SinkRate;
+  GroundSpeed = gear.GroundSpeed;
+  TakeoffDistanceTraveled = gear.TakeoffDistanceTraveled;
+  TakeoffDistanceTraveled50ft = gear.TakeoffDistanceTraveled50ft;
+  LandingDistanceTraveled = gear.LandingDistanceTraveled;
+  MaximumStrutForce = gear.MaximumStrutForce;
+  StrutForce = gear.StrutForce;
+  MaximumStrutTravel = gear.MaximumStrutTravel;
+  FCoeff = gear.FCoeff;
+  WheelSlip = gear.WheelSlip;
+  GearPos = gear.GearPos;
+  WOW = gear.WOW;
+  lastWOW = gear.lastWOW;
+  FirstContact = gear.FirstContact;
+  StartedGroundRun = gear.StartedGroundRun;
+  LandingReported = gear.LandingReported;
+  TakeoffReported = gear.TakeoffReported;
+  ReportEnable = gear.ReportEnable;
+  Castered = gear.Castered;
+  StaticFriction = gear.StaticFriction;
+  useFCSGearPos = gear.useFCSGearPos;
+  for (int i=0; i < 3; i++) LMultiplier[i] = gear.LMultiplier[i];
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Build a local "ground" coordinate system defined by
 //  eX : projection of the rolling direction on the ground
@@ -647,7 +719,7 @@ void FGLGear::ComputeVerticalStrutForce()
   switch (eContactType) {
   case ctBOGEY:
     // Project back the strut force in the local coordinate frame of the ground
-    vFn(eZ) = StrutForce / (mTGear.Transposed()*vGroundNormal)(eZ);
+    vFn(eZ) = StrutForce / mTGear.TransposedProduct(vGroundNormal)(eZ);
     break;
   case ctSTRUCTURE:
     vFn(eZ) = -StrutForce;
@@ -754,7 +826,7 @@ void FGLGear::UpdateForces(void)
     vFn(eY) = LMultiplier[ftSide].value;
   }
   else {
-    FGColumnVector3 forceDir = mT.Transposed() * LMultiplier[ftDynamic].ForceJacobian;
+    FGColumnVector3 forceDir = mT.TransposedProduct(LMultiplier[ftDynamic].ForceJacobian);
     vFn(eX) = LMultiplier[ftDynamic].value * forceDir(eX);
     vFn(eY) = LMultiplier[ftDynamic].value * forceDir(eY);
   }
@@ -44,6 +44,7 @@ INCLUDES
 #include "math/FGLocation.h"
 #include "math/LagrangeMultiplier.h"
 #include "FGSurface.h"
+#include "input_output/FGGroundCallback.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -239,6 +240,20 @@ public:
    */
   const FGColumnVector3& GetBodyForces(FGSurface *surface = NULL);
 
+  /** The Force vector for this gear computed from a contact point that has
+      already been queried from the ground callback (see GetContactLocation()).
+      @param surface another surface to interact with, set to NULL for none.
+      @param point the contact point below the gear or NULL if the gear is
+                   known to be above the ground.
+   */
+  const FGColumnVector3& GetBodyForces(FGSurface *surface,
+                                    const FGGroundCallback::ContactPoint* point);
+  void CopyState(const FGForce& source) override;
+
+  /** Gets the location where the ground must be queried: the theoretical
+      location of the wheel if the strut is not compressed. */
+  FGLocation GetContactLocation(void) const;
+
   /// Gets the location of the gear in Body axes
   FGColumnVector3 GetBodyLocation(void) const {
     return Ts2b * (vXYZn - in.vXYZcg);
@@ -287,11 +302,11 @@ public:
 
   double GetWheelRollForce(void) {
     UpdateForces();
-    FGColumnVector3 vForce = mTGear.Transposed() * FGForce::GetBodyForces();
+    FGColumnVector3 vForce = mTGear.TransposedProduct(FGForce::GetBodyForces());
     return vForce(eX)*cos(SteerAngle) + vForce(eY)*sin(SteerAngle); }
   double GetWheelSideForce(void) {
     UpdateForces();
-    FGColumnVector3 vForce = mTGear.Transposed() * FGForce::GetBodyForces();
+    FGColumnVector3 vForce = mTGear.TransposedProduct(FGForce::GetBodyForces());
     return vForce(eY)*cos(SteerAngle) - vForce(eX)*sin(SteerAngle); }
   double GetBodyXForce(void) {
     UpdateForces();
@@ -58,6 +58,10 @@ FGMassBalance::FGMassBalance(FGFDMExec* fdmex)
 {
   Name = "FGMassBalance";
   Weight = EmptyWeight = Mass = 0.0;
+  PointMassWeight = 0.0;
+  InertiaDirty = true;
+  InertiaUpdates = 0;
+  InertiaThreshold = 0.0;
 
   vbaseXYZcg.InitMatrix();
   vXYZcg.InitMatrix();
@@ -91,6 +95,8 @@ bool FGMassBalance::InitModel(void)
 
   vLastXYZcg.InitMatrix();
   vDeltaXYZcg.InitMatrix();
+  InertiaDirty = true;
+  InertiaUpdates = 0;
 
   return true;
 }
@@ -180,9 +186,6 @@ bool FGMassBalance::Load(Element* document)
 
 bool FGMassBalance::Run(bool Holding)
 {
-  double denom, k1, k2, k3, k4, k5, k6;
-  double Ixx, Iyy, Izz, Ixy, Ixz, Iyz;
-
   if (FGModel::Run(Holding)) return true;
   if (Holding) return false;
 
@@ -193,7 +196,9 @@ bool FGMassBalance::Run(bool Holding)
     if (FDMExec->GetChildFDM(fdm)->mated) ChildFDMWeight += FDMExec->GetChildFDM(fdm)->exec->GetMassBalance()->GetWeight();
   }
 
-  Weight = EmptyWeight + in.TanksWeight + GetTotalPointMassWeight()
+  if (UpdatePointMasses()) InertiaDirty = true;
+
+  Weight = EmptyWeight + in.TanksWeight + PointMassWeight
     + in.GasMass*slugtolb + ChildFDMWeight;
 
   Mass = lbtoslug*Weight;
@@ -201,7 +206,7 @@ bool FGMassBalance::Run(bool Holding)
 // Calculate new CG
 
   vXYZcg = (EmptyWeight*vbaseXYZcg
-            + GetPointMassMoment()
+            + PointMassCG
             + in.TanksMoment
             + in.GasMoment) / Weight;
 
@@ -219,6 +224,117 @@ bool FGMassBalance::Run(bool Holding)
 
 // Calculate new total moments of inertia
 
+  if (InertiaNeedsUpdate()) CalculateInertias();
+
+  RunPostFunctions();
+
+  Debug(0);
+
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMassBalance::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& massBalance = static_cast<const FGMassBalance&>(source);
+  in = massBalance.in;
+  Weight = massBalance.Weight;
+  EmptyWeight = massBalance.EmptyWeight;
+  Mass = massBalance.Mass;
+  mJ = massBalance.mJ;
+  mJinv = massBalance.mJinv;
+  pmJ = massBalance.pmJ;
+  baseJ = massBalance.baseJ;
+  vXYZcg = massBalance.vXYZcg;
+  vLastXYZcg = massBalance.vLastXYZcg;
+  vDeltaXYZcg = massBalance.vDeltaXYZcg;
+  vDeltaXYZcgBody = massBalance.vDeltaXYZcgBody;
+  vXYZtank = massBalance.vXYZtank;
+  vbaseXYZcg = massBalance.vbaseXYZcg;
+  vPMxyz = massBalance.vPMxyz;
+  PointMassCG = massBalance.PointMassCG;
+  PointMassWeight = massBalance.PointMassWeight;
+  InertiaDirty = massBalance.InertiaDirty;
+  InertiaUpdates = massBalance.InertiaUpdates;
+  vInertiaXYZcg = massBalance.vInertiaXYZcg;
+  InertiaTanks = massBalance.InertiaTanks;
+  InertiaGas = massBalance.InertiaGas;
+
+  for (unsigned int i=0; i < PointMasses.size(); i++) {
+    const PointMass* pm = massBalance.PointMasses[i];
+    PointMasses[i]->Location = pm->Location;
+    PointMasses[i]->Weight = pm->Weight;
+    PointMasses[i]->mPMInertia = pm->mPMInertia;
+    PointMasses[i]->Modified = pm->Modified;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Updates the total weight and moment of the point masses if any of them has
+// been modified since the previous call.
+
+bool FGMassBalance::UpdatePointMasses(void)
+{
+  bool modified = false;
+
+  for (auto pm: PointMasses) {
+    if (pm->Modified) {
+      modified = true;
+      pm->Modified = false;
+    }
+  }
+
+  if (modified) {
+    PointMassWeight = GetTotalPointMassWeight();
+    GetPointMassMoment();
+  }
+
+  return modified;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static double MaxAbsDifference(const FGMatrix33& a, const FGMatrix33& b)
+{
+  double diff = 0.0;
+
+  for (unsigned int i=1; i<=3; i++)
+    for (unsigned int j=1; j<=3; j++)
+      diff = max(diff, fabs(a(i,j) - b(i,j)));
+
+  return diff;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The variations of the tank and gas inertias are relative to the largest
+// moment of inertia. The CG displacement is relative to the radius of gyration
+// about the corresponding axis since the parallel axis term varies by about
+// twice that ratio.
+
+bool FGMassBalance::InertiaNeedsUpdate(void) const
+{
+  if (InertiaDirty) return true;
+
+  double Jmax = max(max(mJ(1,1), mJ(2,2)), mJ(3,3));
+  double Rgyr = Mass > 0.0 ? sqrt(max(Jmax, 0.0)/Mass) : 0.0;
+
+  return MaxAbsDifference(in.TankInertia, InertiaTanks)
+           + MaxAbsDifference(in.GasInertia, InertiaGas)
+           > InertiaThreshold*Jmax
+         || inchtoft*(vXYZcg - vInertiaXYZcg).Magnitude()
+           > InertiaThreshold*Rgyr;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMassBalance::CalculateInertias(void)
+{
+  double denom, k1, k2, k3, k4, k5, k6;
+  double Ixx, Iyy, Izz, Ixy, Ixz, Iyz;
+
   // At first it is the base configuration inertia matrix ...
   mJ = baseJ;
   // ... with the additional term originating from the parallel axis theorem.
@@ -254,11 +370,11 @@ bool FGMassBalance::Run(bool Holding)
             k2, k4, k5,
             k3, k5, k6 };
 
-  RunPostFunctions();
-
-  Debug(0);
-
-  return false;
+  vInertiaXYZcg = vXYZcg;
+  InertiaTanks = in.TankInertia;
+  InertiaGas = in.GasInertia;
+  InertiaDirty = false;
+  InertiaUpdates++;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -421,6 +537,9 @@ void FGMassBalance::bind(void)
                        &FGMassBalance::GetIxz);
   PropertyManager->Tie("inertia/iyz-slugs_ft2", this,
                        &FGMassBalance::GetIyz);
+  PropertyManager->Tie("inertia/update-threshold", &InertiaThreshold);
+  PropertyManager->Tie("inertia/update-count", this,
+                       &FGMassBalance::GetInertiaUpdates);
   typedef int (FGMassBalance::*iOPV)() const;
   PropertyManager->Tie("inertia/print-mass-properties", this, (iOPV)0,
                        &FGMassBalance::GetMassPropertiesReport);
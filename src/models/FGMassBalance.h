@@ -111,6 +111,16 @@ CLASS DOCUMENTATION
     </mass_balance>
 @endcode
     
+    The inertia matrix and its inverse are only recomputed when their inputs
+    have been modified: the CG, the inertia of the tanks and of the gas cells,
+    the point masses and the base properties of the aircraft. The property
+    <tt>inertia/update-threshold</tt> sets the relative variation of these
+    inputs below which the inertia matrix is not updated. Its default value 0
+    updates the matrix as soon as an input has changed so the results are
+    exactly the same as if it was recomputed at each time step; a negative
+    value updates it at each time step. The number of updates is counted by
+    the property <tt>inertia/update-count</tt>.
+
     @see Stevens and Lewis, "Flight Control & Simulation"
     @see Bernard Etkin, " Dynamics Of Atmosferic Flight"
     @see https://en.wikipedia.org/wiki/Moment_of_inertia#Inertia_tensor
@@ -139,6 +149,7 @@ public:
                      on a socket for the "Resume" command to be given.  @return
                      false if no error */
   bool Run(bool Holding) override;
+  void CopyState(const FGModel& source) override;
 
   double GetMass(void) const {return Mass;}
   double GetWeight(void) const {return Weight;}
@@ -184,8 +195,11 @@ public:
    */
   FGColumnVector3 StructuralToBody(const FGColumnVector3& r) const;
 
-  void SetEmptyWeight(double EW) { EmptyWeight = EW;}
-  void SetBaseCG(const FGColumnVector3& CG) {vbaseXYZcg = vXYZcg = CG;}
+  void SetEmptyWeight(double EW) { EmptyWeight = EW; InertiaDirty = true;}
+  void SetBaseCG(const FGColumnVector3& CG) {
+    vbaseXYZcg = vXYZcg = CG;
+    InertiaDirty = true;
+  }
 
   void AddPointMass(Element* el);
   double GetTotalPointMassWeight(void) const;
@@ -195,7 +209,12 @@ public:
   const FGMatrix33& GetJ(void) const {return mJ;}
   /// Returns the inverse of the inertia matrix expressed in the body frame.
   const FGMatrix33& GetJinv(void) const {return mJinv;}
-  void SetAircraftBaseInertias(const FGMatrix33& BaseJ) {baseJ = BaseJ;}
+  void SetAircraftBaseInertias(const FGMatrix33& BaseJ) {
+    baseJ = BaseJ;
+    InertiaDirty = true;
+  }
+  /// Returns the number of times the inertia matrix has been updated.
+  int GetInertiaUpdates(void) const {return InertiaUpdates;}
   void GetMassPropertiesReport(int i);
   
   struct Inputs {
@@ -225,7 +244,18 @@ private:
   FGColumnVector3 vbaseXYZcg;
   FGColumnVector3 vPMxyz;
   FGColumnVector3 PointMassCG;
+  double PointMassWeight;
+  // Inputs of the last update of the inertia matrix.
+  bool InertiaDirty;
+  int InertiaUpdates;
+  double InertiaThreshold;
+  FGColumnVector3 vInertiaXYZcg;
+  FGMatrix33 InertiaTanks;
+  FGMatrix33 InertiaGas;
   const FGMatrix33& CalculatePMInertias(void);
+  bool UpdatePointMasses(void);
+  bool InertiaNeedsUpdate(void) const;
+  void CalculateInertias(void);
   double GetIxx(void) const { return mJ(1,1); }
   double GetIyy(void) const { return mJ(2,2); }
   double GetIzz(void) const { return mJ(3,3); }
@@ -238,7 +268,7 @@ private:
   struct PointMass {
     PointMass(double w, FGColumnVector3& vXYZ) :
       eShapeType(esUnspecified), Location(vXYZ), Weight(w), Radius(0.0),
-      Length(0.0) {}
+      Length(0.0), Modified(true) {}
 
     void CalculateShapeInertia(void) {
       switch(eShapeType) {
@@ -274,6 +304,7 @@ private:
     double Length; /// Length in feet.
     std::string Name;
     FGMatrix33 mPMInertia;
+    bool Modified; /// Set when the mass properties are modified.
 
     double GetPointMassLocation(int axis) const {return Location(axis);}
     double GetPointMassWeight(void) const {return Weight;}
@@ -282,16 +313,23 @@ private:
     const FGMatrix33& GetPointMassInertia(void) {return mPMInertia;}
     const std::string& GetName(void) {return Name;}
 
-    void SetPointMassLocation(int axis, double value) {Location(axis) = value;}
+    void SetPointMassLocation(int axis, double value) {
+      Location(axis) = value;
+      Modified = true;
+    }
     void SetPointMassWeight(double wt) {
       Weight = wt;
       CalculateShapeInertia();
+      Modified = true;
     }
     void SetPointMassShapeType(esShape st) {eShapeType = st;}
     void SetRadius(double r) {Radius = r;}
     void SetLength(double l) {Length = l;}
     void SetName(const std::string& name) {Name = name;}
-    void SetPointMassMoI(const FGMatrix33& MoI) { mPMInertia = MoI; }
+    void SetPointMassMoI(const FGMatrix33& MoI) {
+      mPMInertia = MoI;
+      Modified = true;
+    }
     double GetPointMassMoI(int r, int c) {return mPMInertia(r,c);}
 
     void bind(FGPropertyManager* PropertyManager, unsigned int num);
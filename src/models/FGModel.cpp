@@ -65,6 +65,7 @@ FGModel::FGModel(FGFDMExec* fdmex)
 
   exe_ctr     = 1;
   rate        = 1;
+  substeps    = 1;
 
   if (debug_lvl & 2) cout << "              FGModel Base Class" << endl;
 }
@@ -86,6 +87,14 @@ bool FGModel::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGModel::CopyState(const FGModel& source)
+{
+  exe_ctr = source.exe_ctr;
+  CopyFunctionValues(source);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGModel::Run(bool Holding)
 {
   if (debug_lvl & 4) cout << "Entering Run() for model " << Name << endl;
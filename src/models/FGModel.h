@@ -87,10 +87,28 @@ public:
   virtual bool Run(bool Holding);
 
   bool InitModel(void) override;
+  /** Copies the state of a model (see FGFDMExec::Clone()).
+      The models override this method to copy their internal states as well as
+      the outputs that the other models read before the model is run again.
+      @param source a model of the same type built from the same definition. */
+  virtual void CopyState(const FGModel& source);
   /// Set the ouput rate for the model in frames
   void SetRate(unsigned int tt) {rate = tt;}
   /// Get the output rate for the model in frames
   unsigned int GetRate(void)   {return rate;}
+  /** Set the number of sub-steps executed by the model in each frame.
+      A model with N sub-steps is run N times per frame. Only the models
+      that integrate their state with GetStepDeltaT() advance by dt/N at each
+      run, which is why FGFDMExec::SetModelSubSteps() restricts sub-stepping to
+      the flight control systems.
+      @param n number of sub-steps (values lower than 1 are set to 1) */
+  void SetSubSteps(unsigned int n) {substeps = n < 1 ? 1 : n;}
+  /// Get the number of sub-steps executed by the model in each frame
+  unsigned int GetSubSteps(void) const {return substeps;}
+  /** Get the time step seen by the model each time it is run.
+      @param dt the executive time step
+      @return dt*rate/substeps */
+  double GetStepDeltaT(double dt) const {return dt * rate / substeps;}
   FGFDMExec* GetExec(void)     {return FDMExec;}
 
   void SetPropertyManager(std::shared_ptr<FGPropertyManager> fgpm) { PropertyManager=fgpm;}
@@ -101,6 +119,7 @@ public:
 protected:
   unsigned int exe_ctr;
   unsigned int rate;
+  unsigned int substeps;
   std::string Name;
 
   /** Uploads this model in memory.
@@ -87,13 +87,10 @@ FGPropagate::FGPropagate(FGFDMExec* fdmex)
 
   Inertial = FDMExec->GetInertial();
 
-  /// These define the indices use to select the various integrators.
-  // eNone = 0, eRectEuler, eTrapezoidal, eAdamsBashforth2, eAdamsBashforth3, eAdamsBashforth4};
-
-  integrator_rotational_rate = eRectEuler;
-  integrator_translational_rate = eAdamsBashforth2;
-  integrator_rotational_position = eRectEuler;
-  integrator_translational_position = eAdamsBashforth3;
+  SetIntegrator(eRotationalRate, eRectEuler);
+  SetIntegrator(eTranslationalRate, eAdamsBashforth2);
+  SetIntegrator(eRotationalPosition, eRectEuler);
+  SetIntegrator(eTranslationalPosition, eAdamsBashforth3);
 
   VState.dqPQRidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
   VState.dqUVWidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
@@ -102,6 +99,11 @@ FGPropagate::FGPropagate(FGFDMExec* fdmex)
 
   epa = 0.0;
 
+  TerrainContactRevision = 0;
+  TerrainContactValid = false;
+  LocationUpdates = 0;
+  LastNumComputeDerived = 0;
+
   bind();
   Debug(0);
 }
@@ -128,10 +130,10 @@ bool FGPropagate::InitModel(void)
   VState.dqInertialVelocity.resize(5, FGColumnVector3(0.0,0.0,0.0));
   VState.dqQtrndot.resize(5, FGColumnVector3(0.0,0.0,0.0));
 
-  integrator_rotational_rate = eRectEuler;
-  integrator_translational_rate = eAdamsBashforth2;
-  integrator_rotational_position = eRectEuler;
-  integrator_translational_position = eAdamsBashforth3;
+  SetIntegrator(eRotationalRate, eRectEuler);
+  SetIntegrator(eTranslationalRate, eAdamsBashforth2);
+  SetIntegrator(eRotationalPosition, eRectEuler);
+  SetIntegrator(eTranslationalPosition, eAdamsBashforth3);
 
   epa = 0.0;
 
@@ -217,6 +219,11 @@ Inertial.
 
 bool FGPropagate::Run(bool Holding)
 {
+  unsigned long numComputeDerived = VState.vLocation.GetNumComputeDerived()
+    + TerrainContact.contact.GetNumComputeDerived();
+  LocationUpdates = numComputeDerived - LastNumComputeDerived;
+  LastNumComputeDerived = numComputeDerived;
+
   if (FGModel::Run(Holding)) return true;  // Fast return if we have nothing to do ...
   if (Holding) return false;
 
@@ -225,10 +232,7 @@ bool FGPropagate::Run(bool Holding)
   // Propagate rotational / translational velocity, angular /translational position, respectively.
 
   if (!FDMExec->IntegrationSuspended()) {
-    Integrate(VState.qAttitudeECI,      VState.vQtrndot,      VState.dqQtrndot,          dt, integrator_rotational_position);
-    Integrate(VState.vPQRi,             in.vPQRidot,          VState.dqPQRidot,          dt, integrator_rotational_rate);
-    Integrate(VState.vInertialPosition, VState.vInertialVelocity, VState.dqInertialVelocity, dt, integrator_translational_position);
-    Integrate(VState.vInertialVelocity, in.vUVWidot,          VState.dqUVWidot,          dt, integrator_translational_rate);
+    for (auto step: IntegrateSteps) (this->*step)(dt);
   }
 
   // CAUTION : the order of the operations below is very important to get
@@ -333,33 +337,34 @@ void FGPropagate::CalculateUVW(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGPropagate::Integrate( FGColumnVector3& Integrand,
-                             FGColumnVector3& Val,
-                             deque <FGColumnVector3>& ValDot,
-                             double dt,
-                             eIntegrateType integration_type)
+// Multistep integration of a state variable. The integration scheme is a
+// template parameter so the switch below is resolved at compile time.
+
+template <FGPropagate::eIntegrateType type, class T>
+static void IntegrateMultistep(T& Integrand, const T& Val, deque<T>& ValDot,
+                               double dt)
 {
   ValDot.push_front(Val);
   ValDot.pop_back();
 
-  switch(integration_type) {
-  case eRectEuler:       Integrand += dt*ValDot[0];
+  switch(type) {
+  case FGPropagate::eRectEuler:       Integrand += dt*ValDot[0];
     break;
-  case eTrapezoidal:     Integrand += 0.5*dt*(ValDot[0] + ValDot[1]);
+  case FGPropagate::eTrapezoidal:     Integrand += 0.5*dt*(ValDot[0] + ValDot[1]);
     break;
-  case eAdamsBashforth2: Integrand += dt*(1.5*ValDot[0] - 0.5*ValDot[1]);
+  case FGPropagate::eAdamsBashforth2: Integrand += dt*(1.5*ValDot[0] - 0.5*ValDot[1]);
     break;
-  case eAdamsBashforth3: Integrand += (1/12.0)*dt*(23.0*ValDot[0] - 16.0*ValDot[1] + 5.0*ValDot[2]);
+  case FGPropagate::eAdamsBashforth3: Integrand += (1/12.0)*dt*(23.0*ValDot[0] - 16.0*ValDot[1] + 5.0*ValDot[2]);
     break;
-  case eAdamsBashforth4: Integrand += (1/24.0)*dt*(55.0*ValDot[0] - 59.0*ValDot[1] + 37.0*ValDot[2] - 9.0*ValDot[3]);
+  case FGPropagate::eAdamsBashforth4: Integrand += (1/24.0)*dt*(55.0*ValDot[0] - 59.0*ValDot[1] + 37.0*ValDot[2] - 9.0*ValDot[3]);
     break;
-  case eAdamsBashforth5: Integrand += dt*((1901./720.)*ValDot[0] - (1387./360.)*ValDot[1] + (109./30.)*ValDot[2] - (637./360.)*ValDot[3] + (251./720.)*ValDot[4]);
+  case FGPropagate::eAdamsBashforth5: Integrand += dt*((1901./720.)*ValDot[0] - (1387./360.)*ValDot[1] + (109./30.)*ValDot[2] - (637./360.)*ValDot[3] + (251./720.)*ValDot[4]);
     break;
-  case eNone: // do nothing, freeze translational rate
+  case FGPropagate::eNone: // do nothing, freeze the state variable
     break;
-  case eBuss1:
-  case eBuss2:
-  case eLocalLinearization:
+  case FGPropagate::eBuss1:
+  case FGPropagate::eBuss2:
+  case FGPropagate::eLocalLinearization:
     throw("Can only use Buss (1 & 2) or local linearization integration methods in for rotational position!");
   default:
     break;
@@ -368,106 +373,186 @@ void FGPropagate::Integrate( FGColumnVector3& Integrand,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGPropagate::Integrate( FGQuaternion& Integrand,
-                             FGQuaternion& Val,
-                             deque <FGQuaternion>& ValDot,
-                             double dt,
-                             eIntegrateType integration_type)
+template <FGPropagate::eIntegrateType type>
+void FGPropagate::IntegrateAttitude(double dt)
 {
-  ValDot.push_front(Val);
-  ValDot.pop_back();
+  IntegrateMultistep<type>(VState.qAttitudeECI, VState.vQtrndot,
+                           VState.dqQtrndot, dt);
+  VState.qAttitudeECI.Normalize();
+}
 
-  switch(integration_type) {
-  case eRectEuler:       Integrand += dt*ValDot[0];
-    break;
-  case eTrapezoidal:     Integrand += 0.5*dt*(ValDot[0] + ValDot[1]);
-    break;
-  case eAdamsBashforth2: Integrand += dt*(1.5*ValDot[0] - 0.5*ValDot[1]);
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <>
+void FGPropagate::IntegrateAttitude<FGPropagate::eBuss1>(double dt)
+{
+  VState.dqQtrndot.push_front(VState.vQtrndot);
+  VState.dqQtrndot.pop_back();
+
+  // This is the first order method as described in Samuel R. Buss paper[6].
+  // The formula from Buss' paper is transposed below to quaternions and is
+  // actually the exact solution of the quaternion differential equation
+  // qdot = 1/2*w*q when w is constant.
+  VState.qAttitudeECI = VState.qAttitudeECI * QExp(0.5 * dt * VState.vPQRi);
+
+  // No need to normalize since the quaternion exponential is always normal
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <>
+void FGPropagate::IntegrateAttitude<FGPropagate::eBuss2>(double dt)
+{
+  VState.dqQtrndot.push_front(VState.vQtrndot);
+  VState.dqQtrndot.pop_back();
+
+  // This is the 'augmented second-order method' from S.R. Buss paper [6].
+  // Unlike Runge-Kutta or Adams-Bashforth, it is a one-pass second-order
+  // method (see reference [6]).
+  FGColumnVector3 wi = VState.vPQRi;
+  FGColumnVector3 wdoti = in.vPQRidot;
+  FGColumnVector3 omega = wi + 0.5*dt*wdoti + dt*dt/12.*wdoti*wi;
+  VState.qAttitudeECI = VState.qAttitudeECI * QExp(0.5 * dt * omega);
+
+  // No need to normalize since the quaternion exponential is always normal
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <>
+void FGPropagate::IntegrateAttitude<FGPropagate::eLocalLinearization>(double dt)
+{
+  VState.dqQtrndot.push_front(VState.vQtrndot);
+  VState.dqQtrndot.pop_back();
+
+  // This is the local linearization algorithm of Barker et al. (see ref. [7])
+  // It is also a one-pass second-order method. The code below is based on the
+  // more compact formulation issued from equation (107) of ref. [8]. The
+  // constants C1, C2, C3 and C4 have the same value than those in ref. [7] pp. 11
+  FGColumnVector3 wi = 0.5 * VState.vPQRi;
+  FGColumnVector3 wdoti = 0.5 * in.vPQRidot;
+  double omegak2 = DotProduct(VState.vPQRi, VState.vPQRi);
+  double omegak = omegak2 > 1E-6 ? sqrt(omegak2) : 1E-6;
+  double rhok = 0.5 * dt * omegak;
+  double C1 = cos(rhok);
+  double C2 = 2.0 * sin(rhok) / omegak;
+  double C3 = 4.0 * (1.0 - C1) / (omegak*omegak);
+  double C4 = 4.0 * (dt - C2) / (omegak*omegak);
+  FGColumnVector3 Omega = C2*wi + C3*wdoti + C4*wi*wdoti;
+  FGQuaternion q;
+
+  q(1) = C1 - C4*DotProduct(wi, wdoti);
+  q(2) = Omega(eP);
+  q(3) = Omega(eQ);
+  q(4) = Omega(eR);
+
+  VState.qAttitudeECI = VState.qAttitudeECI * q;
+
+  /* Cross check with ref. [7] pp.11-12 formulas and code pp. 20
+  double pk = VState.vPQRi(eP);
+  double qk = VState.vPQRi(eQ);
+  double rk = VState.vPQRi(eR);
+  double pdotk = in.vPQRidot(eP);
+  double qdotk = in.vPQRidot(eQ);
+  double rdotk = in.vPQRidot(eR);
+  double Ap = -0.25 * (pk*pdotk + qk*qdotk + rk*rdotk);
+  double Bp = 0.25 * (pk*qdotk - qk*pdotk);
+  double Cp = 0.25 * (pdotk*rk - pk*rdotk);
+  double Dp = 0.25 * (qk*rdotk - qdotk*rk);
+  double C2p = sin(rhok) / omegak;
+  double C3p = 2.0 * (1.0 - cos(rhok)) / (omegak*omegak);
+  double H = C1 + C4 * Ap;
+  double G = -C2p*rk - C3p*rdotk + C4*Bp;
+  double J = C2p*qk + C3p*qdotk - C4*Cp;
+  double K = C2p*pk + C3p*pdotk - C4*Dp;
+
+  cout << "q:       " << q << endl;
+
+  // Warning! In the paper of Barker et al. the quaternion components are not
+  // ordered the same way as in JSBSim (see equations (2) and (3) of ref. [7]
+  // as well as the comment just below equation (3))
+  cout << "FORTRAN: " << H << " , " << K << " , " << J << " , " << -G << endl;*/
+
+  // The quaternion q is not normal so the normalization needs to be done.
+  VState.qAttitudeECI.Normalize();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <int integrand, FGPropagate::eIntegrateType type>
+void FGPropagate::IntegrateStep(double dt)
+{
+  switch(integrand) {
+  case eRotationalPosition:
+    IntegrateAttitude<type>(dt);
     break;
-  case eAdamsBashforth3: Integrand += (1/12.0)*dt*(23.0*ValDot[0] - 16.0*ValDot[1] + 5.0*ValDot[2]);
+  case eRotationalRate:
+    IntegrateMultistep<type>(VState.vPQRi, in.vPQRidot, VState.dqPQRidot, dt);
     break;
-  case eAdamsBashforth4: Integrand += (1/24.0)*dt*(55.0*ValDot[0] - 59.0*ValDot[1] + 37.0*ValDot[2] - 9.0*ValDot[3]);
+  case eTranslationalPosition:
+    IntegrateMultistep<type>(VState.vInertialPosition, VState.vInertialVelocity,
+                             VState.dqInertialVelocity, dt);
     break;
-  case eAdamsBashforth5: Integrand += dt*((1901./720.)*ValDot[0] - (1387./360.)*ValDot[1] + (109./30.)*ValDot[2] - (637./360.)*ValDot[3] + (251./720.)*ValDot[4]);
+  case eTranslationalRate:
+    IntegrateMultistep<type>(VState.vInertialVelocity, in.vUVWidot,
+                             VState.dqUVWidot, dt);
     break;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <int integrand>
+FGPropagate::IntegrateStepFn FGPropagate::SelectIntegrateStep(int type)
+{
+  switch(type) {
+  case eRectEuler:
+    return &FGPropagate::IntegrateStep<integrand, eRectEuler>;
+  case eTrapezoidal:
+    return &FGPropagate::IntegrateStep<integrand, eTrapezoidal>;
+  case eAdamsBashforth2:
+    return &FGPropagate::IntegrateStep<integrand, eAdamsBashforth2>;
+  case eAdamsBashforth3:
+    return &FGPropagate::IntegrateStep<integrand, eAdamsBashforth3>;
+  case eAdamsBashforth4:
+    return &FGPropagate::IntegrateStep<integrand, eAdamsBashforth4>;
+  case eAdamsBashforth5:
+    return &FGPropagate::IntegrateStep<integrand, eAdamsBashforth5>;
   case eBuss1:
-    {
-      // This is the first order method as described in Samuel R. Buss paper[6].
-      // The formula from Buss' paper is transposed below to quaternions and is
-      // actually the exact solution of the quaternion differential equation
-      // qdot = 1/2*w*q when w is constant.
-      Integrand = Integrand * QExp(0.5 * dt * VState.vPQRi);
-    }
-    return; // No need to normalize since the quaternion exponential is always normal
+    return &FGPropagate::IntegrateStep<integrand, eBuss1>;
   case eBuss2:
-    {
-      // This is the 'augmented second-order method' from S.R. Buss paper [6].
-      // Unlike Runge-Kutta or Adams-Bashforth, it is a one-pass second-order
-      // method (see reference [6]).
-      FGColumnVector3 wi = VState.vPQRi;
-      FGColumnVector3 wdoti = in.vPQRidot;
-      FGColumnVector3 omega = wi + 0.5*dt*wdoti + dt*dt/12.*wdoti*wi;
-      Integrand = Integrand * QExp(0.5 * dt * omega);
-    }
-    return; // No need to normalize since the quaternion exponential is always normal
+    return &FGPropagate::IntegrateStep<integrand, eBuss2>;
   case eLocalLinearization:
-    {
-      // This is the local linearization algorithm of Barker et al. (see ref. [7])
-      // It is also a one-pass second-order method. The code below is based on the
-      // more compact formulation issued from equation (107) of ref. [8]. The
-      // constants C1, C2, C3 and C4 have the same value than those in ref. [7] pp. 11
-      FGColumnVector3 wi = 0.5 * VState.vPQRi;
-      FGColumnVector3 wdoti = 0.5 * in.vPQRidot;
-      double omegak2 = DotProduct(VState.vPQRi, VState.vPQRi);
-      double omegak = omegak2 > 1E-6 ? sqrt(omegak2) : 1E-6;
-      double rhok = 0.5 * dt * omegak;
-      double C1 = cos(rhok);
-      double C2 = 2.0 * sin(rhok) / omegak;
-      double C3 = 4.0 * (1.0 - C1) / (omegak*omegak);
-      double C4 = 4.0 * (dt - C2) / (omegak*omegak);
-      FGColumnVector3 Omega = C2*wi + C3*wdoti + C4*wi*wdoti;
-      FGQuaternion q;
-
-      q(1) = C1 - C4*DotProduct(wi, wdoti);
-      q(2) = Omega(eP);
-      q(3) = Omega(eQ);
-      q(4) = Omega(eR);
-
-      Integrand = Integrand * q;
-
-      /* Cross check with ref. [7] pp.11-12 formulas and code pp. 20
-      double pk = VState.vPQRi(eP);
-      double qk = VState.vPQRi(eQ);
-      double rk = VState.vPQRi(eR);
-      double pdotk = in.vPQRidot(eP);
-      double qdotk = in.vPQRidot(eQ);
-      double rdotk = in.vPQRidot(eR);
-      double Ap = -0.25 * (pk*pdotk + qk*qdotk + rk*rdotk);
-      double Bp = 0.25 * (pk*qdotk - qk*pdotk);
-      double Cp = 0.25 * (pdotk*rk - pk*rdotk);
-      double Dp = 0.25 * (qk*rdotk - qdotk*rk);
-      double C2p = sin(rhok) / omegak;
-      double C3p = 2.0 * (1.0 - cos(rhok)) / (omegak*omegak);
-      double H = C1 + C4 * Ap;
-      double G = -C2p*rk - C3p*rdotk + C4*Bp;
-      double J = C2p*qk + C3p*qdotk - C4*Cp;
-      double K = C2p*pk + C3p*pdotk - C4*Dp;
-
-      cout << "q:       " << q << endl;
-
-      // Warning! In the paper of Barker et al. the quaternion components are not
-      // ordered the same way as in JSBSim (see equations (2) and (3) of ref. [7]
-      // as well as the comment just below equation (3))
-      cout << "FORTRAN: " << H << " , " << K << " , " << J << " , " << -G << endl;*/
-    }
-    break; // The quaternion q is not normal so the normalization needs to be done.
-  case eNone: // do nothing, freeze rotational rate
+    return &FGPropagate::IntegrateStep<integrand, eLocalLinearization>;
+  default: // eNone and unknown values freeze the state variable
+    return &FGPropagate::IntegrateStep<integrand, eNone>;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::SetIntegrator(int integrand, int type)
+{
+  switch(integrand) {
+  case eRotationalPosition:
+    IntegrateSteps[integrand] = SelectIntegrateStep<eRotationalPosition>(type);
     break;
-  default:
+  case eRotationalRate:
+    IntegrateSteps[integrand] = SelectIntegrateStep<eRotationalRate>(type);
+    break;
+  case eTranslationalPosition:
+    IntegrateSteps[integrand] = SelectIntegrateStep<eTranslationalPosition>(type);
     break;
+  case eTranslationalRate:
+    IntegrateSteps[integrand] = SelectIntegrateStep<eTranslationalRate>(type);
+    break;
+  default:
+    cerr << "FGPropagate::SetIntegrator: unknown state variable " << integrand
+         << endl;
+    return;
   }
 
-  Integrand.Normalize();
+  Integrators[integrand] = type;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -586,23 +671,41 @@ void FGPropagate::SetAltitudeASL(double altASL)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+const FGGroundCallback::ContactPoint& FGPropagate::GetTerrainContact(void) const
+{
+  const FGColumnVector3& position = VState.vLocation;
+  unsigned int revision = Inertial->GetGroundRevision();
+
+  if (!TerrainContactValid || TerrainContactRevision != revision
+      || TerrainContactPosition != position) {
+    TerrainContact.contact.SetEllipse(in.SemiMajor, in.SemiMinor);
+    TerrainContact.agl = Inertial->GetContactPoint(VState.vLocation,
+                                                   TerrainContact.contact,
+                                                   TerrainContact.normal,
+                                                   TerrainContact.velocity,
+                                                   TerrainContact.ang_velocity);
+    TerrainContactPosition = position;
+    TerrainContactRevision = revision;
+    TerrainContactValid = true;
+  }
+
+  return TerrainContact;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGPropagate::RecomputeLocalTerrainVelocity()
 {
-  FGLocation contact;
-  FGColumnVector3 normal;
-  Inertial->GetContactPoint(VState.vLocation, contact, normal,
-                            LocalTerrainVelocity, LocalTerrainAngularVelocity);
+  const FGGroundCallback::ContactPoint& terrain = GetTerrainContact();
+  LocalTerrainVelocity = terrain.velocity;
+  LocalTerrainAngularVelocity = terrain.ang_velocity;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGPropagate::GetTerrainElevation(void) const
 {
-  FGColumnVector3 vDummy;
-  FGLocation contact;
-  contact.SetEllipse(in.SemiMajor, in.SemiMinor);
-  Inertial->GetContactPoint(VState.vLocation, contact, vDummy, vDummy, vDummy);
-  return contact.GetGeodAltitude();
+  return GetTerrainContact().contact.GetGeodAltitude();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -616,17 +719,14 @@ void FGPropagate::SetTerrainElevation(double terrainElev)
 
 double FGPropagate::GetLocalTerrainRadius(void) const
 {
-  FGLocation contact;
-  FGColumnVector3 vDummy;
-  Inertial->GetContactPoint(VState.vLocation, contact, vDummy, vDummy, vDummy);
-  return contact.GetRadius();
+  return GetTerrainContact().contact.GetRadius();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGPropagate::GetDistanceAGL(void) const
 {
-  return Inertial->GetAltitudeAGL(VState.vLocation);
+  return GetTerrainContact().agl;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -670,6 +770,42 @@ void FGPropagate::SetVState(const VehicleState& vstate)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGPropagate::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& propagate = static_cast<const FGPropagate&>(source);
+  VState = propagate.VState;
+  vVel = propagate.vVel;
+  Tec2b = propagate.Tec2b;
+  Tb2ec = propagate.Tb2ec;
+  Tl2b = propagate.Tl2b;
+  Tb2l = propagate.Tb2l;
+  Tl2ec = propagate.Tl2ec;
+  Tec2l = propagate.Tec2l;
+  Tec2i = propagate.Tec2i;
+  Ti2ec = propagate.Ti2ec;
+  Ti2b = propagate.Ti2b;
+  Tb2i = propagate.Tb2i;
+  Ti2l = propagate.Ti2l;
+  Tl2i = propagate.Tl2i;
+  Qec2b = propagate.Qec2b;
+  epa = propagate.epa;
+  h = propagate.h;
+  Inclination = propagate.Inclination;
+  RightAscension = propagate.RightAscension;
+  Eccentricity = propagate.Eccentricity;
+  PerigeeArgument = propagate.PerigeeArgument;
+  TrueAnomaly = propagate.TrueAnomaly;
+  ApoapsisRadius = propagate.ApoapsisRadius;
+  PeriapsisRadius = propagate.PeriapsisRadius;
+  OrbitalPeriod = propagate.OrbitalPeriod;
+  LocalTerrainVelocity = propagate.LocalTerrainVelocity;
+  LocalTerrainAngularVelocity = propagate.LocalTerrainAngularVelocity;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGPropagate::UpdateVehicleState(void)
 {
   RecomputeLocalTerrainVelocity();
@@ -818,6 +954,7 @@ void FGPropagate::bind(void)
   typedef int (FGPropagate::*iPMF)(void) const;
 
   PropertyManager->Tie("velocities/h-dot-fps", this, &FGPropagate::Gethdot);
+  PropertyManager->Tie("simulation/vehicle-location-updates", this, &FGPropagate::GetLocationUpdates);
 
   PropertyManager->Tie("velocities/v-north-fps", this, eNorth, (PMF)&FGPropagate::GetVel);
   PropertyManager->Tie("velocities/v-east-fps", this, eEast, (PMF)&FGPropagate::GetVel);
@@ -892,10 +1029,18 @@ void FGPropagate::bind(void)
   PropertyManager->Tie("orbital/periapsis-radius-ft", &PeriapsisRadius);
   PropertyManager->Tie("orbital/period-sec", &OrbitalPeriod);
 
-  PropertyManager->Tie("simulation/integrator/rate/rotational", (int*)&integrator_rotational_rate);
-  PropertyManager->Tie("simulation/integrator/rate/translational", (int*)&integrator_translational_rate);
-  PropertyManager->Tie("simulation/integrator/position/rotational", (int*)&integrator_rotational_position);
-  PropertyManager->Tie("simulation/integrator/position/translational", (int*)&integrator_translational_position);
+  PropertyManager->Tie("simulation/integrator/rate/rotational", this,
+                       eRotationalRate, &FGPropagate::GetIntegrator,
+                       &FGPropagate::SetIntegrator);
+  PropertyManager->Tie("simulation/integrator/rate/translational", this,
+                       eTranslationalRate, &FGPropagate::GetIntegrator,
+                       &FGPropagate::SetIntegrator);
+  PropertyManager->Tie("simulation/integrator/position/rotational", this,
+                       eRotationalPosition, &FGPropagate::GetIntegrator,
+                       &FGPropagate::SetIntegrator);
+  PropertyManager->Tie("simulation/integrator/position/translational", this,
+                       eTranslationalPosition, &FGPropagate::GetIntegrator,
+                       &FGPropagate::SetIntegrator);
 
   PropertyManager->Tie("simulation/write-state-file", this, (iPMF)0, &FGPropagate::WriteStateFile);
 }
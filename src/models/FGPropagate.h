@@ -43,6 +43,7 @@ INCLUDES
 #include "models/FGModel.h"
 #include "math/FGLocation.h"
 #include "math/FGQuaternion.h"
+#include "input_output/FGGroundCallback.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -85,6 +86,27 @@ CLASS DOCUMENTATION
     5: Adams Bashforth 4
     @endcode
 
+    The integration scheme of each state variable is selected when the property
+    is set (see SetIntegrator()): each scheme is compiled in its own step
+    function and a time step calls the four selected functions without testing
+    the schemes.
+
+    The ground below the vehicle is queried once and shared by all the
+    functions that need it (altitude above ground, terrain elevation, terrain
+    velocity, etc.). The query is repeated only when the vehicle location or
+    the ground (see FGInertial::GetGroundRevision) have changed.
+
+    The geodetic coordinates and the local frame transforms of the vehicle
+    location are computed once per frame by Run(). The other models receive
+    copies of the location made afterwards, which carry the computed values,
+    so the vehicle location itself is the transform cache shared by all the
+    consumers. The number of times the vehicle location and the ground
+    contact point below it have been converted since the previous frame is
+    reported by the property <tt>simulation/vehicle-location-updates</tt>. The
+    other locations (the contact points of the landing gears, the locations
+    computed by FGAuxiliary or by the initial conditions, etc.) are not
+    counted.
+
     @author Jon S. Berndt, Mathias Froehlich, Bertrand Coconnier
   */
 
@@ -155,6 +177,11 @@ public:
   enum eIntegrateType {eNone = 0, eRectEuler, eTrapezoidal, eAdamsBashforth2,
                        eAdamsBashforth3, eAdamsBashforth4, eBuss1, eBuss2, eLocalLinearization, eAdamsBashforth5};
 
+  /// These define the indices of the integrated state variables, in the order
+  /// they are integrated.
+  enum eIntegrand {eRotationalPosition = 0, eRotationalRate,
+                   eTranslationalPosition, eTranslationalRate, eNumIntegrands};
+
   /** Initializes the FGPropagate class after instantiation and prior to first execution.
       The base class FGModel::InitModel is called first, initializing pointers to the
       other FGModel objects (and others).  */
@@ -162,6 +189,17 @@ public:
 
   void InitializeDerivatives();
 
+  /** Selects the integration scheme of a state variable.
+      @param integrand the state variable (see eIntegrand)
+      @param type the integration scheme (see eIntegrateType). The Buss and
+                  local linearization schemes can only integrate the rotational
+                  position; an exception is thrown at the next time step if
+                  they are selected for another state variable. */
+  void SetIntegrator(int integrand, int type);
+
+  /// Returns the integration scheme of a state variable.
+  int GetIntegrator(int integrand) const { return Integrators[integrand]; }
+
   /** Runs the state propagation model; called by the Executive
       Can pass in a value indicating if the executive is directing the simulation to Hold.
       @param Holding if true, the executive has been directed to hold the sim from
@@ -442,6 +480,17 @@ public:
   double GetTerrainElevation(void) const;
   double GetDistanceAGL(void)  const;
   double GetDistanceAGLKm(void)  const;
+
+  /** Returns the contact point of the ground below the vehicle.
+      The ground is only queried if the vehicle location or the ground have
+      changed since the previous call. */
+  const FGGroundCallback::ContactPoint& GetTerrainContact(void) const;
+
+  /** Returns the number of times the derived values of the vehicle location
+      and of the ground contact point below it have been computed between the
+      two last frames. The other instances of FGLocation are not counted. */
+  int GetLocationUpdates(void) const { return LocationUpdates; }
+
   double GetRadius(void) const {
       if (VState.vLocation.GetRadius() == 0) return 1.0;
       else return VState.vLocation.GetRadius();
@@ -524,6 +573,13 @@ public:
 
   void SetVState(const VehicleState& vstate);
 
+  /** Copies the complete state of another instance: the state vector, the
+      past values of the derivatives used by the multistep integrators, the
+      Earth position angle and the values derived from them (transformation
+      matrices, orbital parameters, etc.)
+      @param source the instance which state is copied. */
+  void CopyState(const FGModel& source) override;
+
   /** Sets the Earth position angle.
       This is the relative angle around the Z axis of the ECEF frame with
       respect to the inertial frame.
@@ -654,26 +710,26 @@ private:
 
   FGColumnVector3 LocalTerrainVelocity, LocalTerrainAngularVelocity;
 
-  eIntegrateType integrator_rotational_rate;
-  eIntegrateType integrator_translational_rate;
-  eIntegrateType integrator_rotational_position;
-  eIntegrateType integrator_translational_position;
+  // Cache of the ground query below the vehicle.
+  mutable FGGroundCallback::ContactPoint TerrainContact;
+  mutable FGColumnVector3 TerrainContactPosition;
+  mutable unsigned int TerrainContactRevision;
+  mutable bool TerrainContactValid;
+
+  int LocationUpdates;
+  unsigned long LastNumComputeDerived;
+
+  typedef void (FGPropagate::*IntegrateStepFn)(double dt);
+  int Integrators[eNumIntegrands];
+  IntegrateStepFn IntegrateSteps[eNumIntegrands];
 
   void CalculateInertialVelocity(void);
   void CalculateUVW(void);
   void CalculateQuatdot(void);
 
-  void Integrate( FGColumnVector3& Integrand,
-                  FGColumnVector3& Val,
-                  std::deque <FGColumnVector3>& ValDot,
-                  double dt,
-                  eIntegrateType integration_type);
-
-  void Integrate( FGQuaternion& Integrand,
-                  FGQuaternion& Val,
-                  std::deque <FGQuaternion>& ValDot,
-                  double dt,
-                  eIntegrateType integration_type);
+  template <eIntegrateType type> void IntegrateAttitude(double dt);
+  template <int integrand, eIntegrateType type> void IntegrateStep(double dt);
+  template <int integrand> static IntegrateStepFn SelectIntegrateStep(int type);
 
   void UpdateLocationMatrices(void);
   void UpdateBodyMatrices(void);
@@ -78,6 +78,7 @@ FGPropulsion::FGPropulsion(FGFDMExec* exec) : FGModel(exec)
   DumpRate = 0.0;
   RefuelRate = 6000.0;
   FuelFreeze = false;
+  SharedEngineFunctions = false;
 
   Debug(0);
 }
@@ -122,6 +123,10 @@ bool FGPropulsion::Run(bool Holding)
   vForces.InitMatrix();
   vMoments.InitMatrix();
 
+  if (SharedEngineFunctions) {
+    for (auto& engine: Engines) engine->EnableSharedPreFunctions(true);
+  }
+
   for (auto& engine: Engines) {
     engine->Calculate();
     ConsumeFuel(engine.get());
@@ -129,6 +134,10 @@ bool FGPropulsion::Run(bool Holding)
     vMoments += engine->GetMoments();     // sum body frame moments
   }
 
+  if (SharedEngineFunctions) {
+    for (auto& engine: Engines) engine->EnableSharedPreFunctions(false);
+  }
+
   TotalFuelQuantity = 0.0;
   TotalOxidizerQuantity = 0.0;
   for (auto& tank: Tanks) {
@@ -153,6 +162,35 @@ bool FGPropulsion::Run(bool Holding)
   return false;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropulsion::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& propulsion = static_cast<const FGPropulsion&>(source);
+  in = propulsion.in;
+  ActiveEngine = propulsion.ActiveEngine;
+  vForces = propulsion.vForces;
+  vMoments = propulsion.vMoments;
+  vTankXYZ = propulsion.vTankXYZ;
+  vXYZtank_arm = propulsion.vXYZtank_arm;
+  tankJ = propulsion.tankJ;
+  refuel = propulsion.refuel;
+  dump = propulsion.dump;
+  FuelFreeze = propulsion.FuelFreeze;
+  TotalFuelQuantity = propulsion.TotalFuelQuantity;
+  TotalOxidizerQuantity = propulsion.TotalOxidizerQuantity;
+  DumpRate = propulsion.DumpRate;
+  RefuelRate = propulsion.RefuelRate;
+
+  for (unsigned int i=0; i<Tanks.size(); i++)
+    Tanks[i]->CopyState(*propulsion.Tanks[i]);
+
+  for (unsigned int i=0; i<Engines.size(); i++)
+    Engines[i]->CopyState(*propulsion.Engines[i]);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 // The engine can tell us how much fuel it needs, but it is up to the propulsion
@@ -374,8 +412,10 @@ bool FGPropulsion::Load(Element* el)
   ReadingEngine = true;
   Element* engine_element = el->FindElement("engine");
   unsigned int numEngines = 0;
+  vector<string> engineFiles;
 
   while (engine_element) {
+    engineFiles.push_back(engine_element->GetAttributeValue("file"));
     if (!ModelLoader.Open(engine_element)) return false;
 
     try {
@@ -419,6 +459,8 @@ bool FGPropulsion::Load(Element* el)
 
   if (numEngines) bind();
 
+  ShareEngineFunctions(engineFiles);
+
   CalculateTankInertias();
 
   if (el->FindElement("dump-rate"))
@@ -434,6 +476,35 @@ bool FGPropulsion::Load(Element* el)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Each engine shares its "pre" functions with the first engine of the same type
+// that has been loaded from the same file. Since the engines are executed in
+// sequence, the functions that read properties of the propulsion subtree are
+// not shared: their value may be modified by the engines executed in between.
+
+void FGPropulsion::ShareEngineFunctions(const vector<string>& files)
+{
+  const FGPropertyNode* propulsion = PropertyManager->GetNode("propulsion");
+
+  for (unsigned int i=1; i<Engines.size(); i++) {
+    if (files[i].empty()) continue;
+
+    for (unsigned int j=0; j<i; j++) {
+      if (files[j] != files[i] || Engines[j]->GetType() != Engines[i]->GetType())
+        continue;
+
+      unsigned int count = Engines[i]->SharePreFunctions(*Engines[j], propulsion);
+      if (count > 0) {
+        SharedEngineFunctions = true;
+        if (debug_lvl > 0)
+          cout << "    Engine " << i << " shares " << count
+               << " functions with engine " << j << endl;
+      }
+      break;
+    }
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 SGPath FGPropulsion::FindFullPathName(const SGPath& path) const
@@ -68,6 +68,14 @@ CLASS DOCUMENTATION
 
     At Run time each engine's Calculate() method is called.
 
+    Engines of the same type that are loaded from the same file share the
+    results of their "pre" functions that only depend on properties outside of
+    the propulsion subtree, such as the thrust tables of FGTurbine which are
+    looked up with the Mach number and the density altitude. These functions
+    are evaluated once per time step by the first engine of the group and
+    their results are copied by the other engines (see
+    FGModelFunctions::SharePreFunctions()).
+
     <h3>Configuration File Format:</h3>
 
   @code
@@ -113,6 +121,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void CopyState(const FGModel& source) override;
 
   bool InitModel(void) override;
 
@@ -200,8 +209,10 @@ private:
   double DumpRate;
   double RefuelRate;
   void ConsumeFuel(FGEngine* engine);
+  void ShareEngineFunctions(const std::vector<std::string>& files);
 
   bool ReadingEngine;
+  bool SharedEngineFunctions;
 
   void bind();
   void Debug(int from) override;
@@ -174,6 +174,22 @@ bool FGStandardAtmosphere::InitModel(void)
 
   return true;
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStandardAtmosphere::CopyState(const FGModel& source)
+{
+  FGAtmosphere::CopyState(source);
+
+  auto& atmosphere = static_cast<const FGStandardAtmosphere&>(source);
+  TemperatureBias = atmosphere.TemperatureBias;
+  TemperatureDeltaGradient = atmosphere.TemperatureDeltaGradient;
+  GradientFadeoutAltitude = atmosphere.GradientFadeoutAltitude;
+  VaporMassFraction = atmosphere.VaporMassFraction;
+  SaturatedVaporPressure = atmosphere.SaturatedVaporPressure;
+  LapseRates = atmosphere.LapseRates;
+  PressureBreakpoints = atmosphere.PressureBreakpoints;
+}
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGStandardAtmosphere::Calculate(double altitude)
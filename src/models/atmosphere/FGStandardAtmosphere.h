@@ -104,6 +104,7 @@ public:
   virtual ~FGStandardAtmosphere();
 
   bool InitModel(void) override;
+  void CopyState(const FGModel& source) override;
 
   //  *************************************************************************
   /// @name Temperature access functions.
@@ -170,6 +170,42 @@ bool FGWinds::Run(bool Holding)
   return false;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWinds::CopyState(const FGModel& source)
+{
+  FGModel::CopyState(source);
+
+  auto& winds = static_cast<const FGWinds&>(source);
+  in = winds.in;
+  MagnitudedAccelDt = winds.MagnitudedAccelDt;
+  MagnitudeAccel = winds.MagnitudeAccel;
+  Magnitude = winds.Magnitude;
+  TurbDirection = winds.TurbDirection;
+  spike = winds.spike;
+  target_time = winds.target_time;
+  strength = winds.strength;
+  vTurbulenceGrad = winds.vTurbulenceGrad;
+  vBodyTurbGrad = winds.vBodyTurbGrad;
+  vTurbPQR = winds.vTurbPQR;
+  oneMinusCosineGust = winds.oneMinusCosineGust;
+  past = winds.past;
+  psiw = winds.psiw;
+  vTotalWindNED = winds.vTotalWindNED;
+  vWindNED = winds.vWindNED;
+  vGustNED = winds.vGustNED;
+  vCosineGust = winds.vCosineGust;
+  vBurstGust = winds.vBurstGust;
+  vThermals = winds.vThermals;
+  vTurbulenceNED = winds.vTurbulenceNED;
+  initLocation = winds.initLocation;
+  thermalLocations = winds.thermalLocations;
+  thermalStrengths = winds.thermalStrengths;
+  thermalHeights = winds.thermalHeights;
+  have_initial_location = winds.have_initial_location;
+  initializedThermals = winds.initializedThermals;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 // psi is the angle that the wind is blowing *towards*
@@ -294,16 +330,6 @@ void FGWinds::Turbulence(double h)
       sig_u = sig_w = POE_Table->GetValue(probability_of_exceedence_index, h);
     }
 
-    // keep values from last timesteps
-    // TODO maybe use deque?
-    static double
-      xi_u_km1 = 0, nu_u_km1 = 0,
-      xi_v_km1 = 0, xi_v_km2 = 0, nu_v_km1 = 0, nu_v_km2 = 0,
-      xi_w_km1 = 0, xi_w_km2 = 0, nu_w_km1 = 0, nu_w_km2 = 0,
-      xi_p_km1 = 0, nu_p_km1 = 0,
-      xi_q_km1 = 0, xi_r_km1 = 0;
-
-
     double
       T_V = in.totalDeltaT, // for compatibility of nomenclature
       sig_p = 1.9/sqrt(L_w*b_w)*sig_w, // Yeager1998, eq. (8)
@@ -337,36 +363,36 @@ void FGWinds::Turbulence(double h)
       // the random numbers nu_*. This means that in the code below, all
       // divisors are strictly positive, too, and no floating point
       // exception should occur.
-      xi_u = -(1 - C_BL*tau_u)/(1 + C_BL*tau_u)*xi_u_km1
-           + sig_u*sqrt(2*tau_u/T_V)/(1 + C_BL*tau_u)*(nu_u + nu_u_km1); // eq. (18)
-      xi_v = -2*(sqr(omega_v) - sqr(C_BL))/sqr(omega_v + C_BL)*xi_v_km1
-           - sqr(omega_v - C_BL)/sqr(omega_v + C_BL) * xi_v_km2
+      xi_u = -(1 - C_BL*tau_u)/(1 + C_BL*tau_u)*past.xi_u_km1
+           + sig_u*sqrt(2*tau_u/T_V)/(1 + C_BL*tau_u)*(nu_u + past.nu_u_km1); // eq. (18)
+      xi_v = -2*(sqr(omega_v) - sqr(C_BL))/sqr(omega_v + C_BL)*past.xi_v_km1
+           - sqr(omega_v - C_BL)/sqr(omega_v + C_BL) * past.xi_v_km2
            + sig_u*sqrt(3*omega_v/T_V)/sqr(omega_v + C_BL)*(
                  (C_BL + omega_v/sqrt(3.))*nu_v
-               + 2/sqrt(3.)*omega_v*nu_v_km1
-               + (omega_v/sqrt(3.) - C_BL)*nu_v_km2); // eq. (20) for v
-      xi_w = -2*(sqr(omega_w) - sqr(C_BL))/sqr(omega_w + C_BL)*xi_w_km1
-           - sqr(omega_w - C_BL)/sqr(omega_w + C_BL) * xi_w_km2
+               + 2/sqrt(3.)*omega_v*past.nu_v_km1
+               + (omega_v/sqrt(3.) - C_BL)*past.nu_v_km2); // eq. (20) for v
+      xi_w = -2*(sqr(omega_w) - sqr(C_BL))/sqr(omega_w + C_BL)*past.xi_w_km1
+           - sqr(omega_w - C_BL)/sqr(omega_w + C_BL) * past.xi_w_km2
            + sig_w*sqrt(3*omega_w/T_V)/sqr(omega_w + C_BL)*(
                  (C_BL + omega_w/sqrt(3.))*nu_w
-               + 2/sqrt(3.)*omega_w*nu_w_km1
-               + (omega_w/sqrt(3.) - C_BL)*nu_w_km2); // eq. (20) for w
-      xi_p = -(1 - C_BLp*tau_p)/(1 + C_BLp*tau_p)*xi_p_km1
-           + sig_p*sqrt(2*tau_p/T_V)/(1 + C_BLp*tau_p) * (nu_p + nu_p_km1); // eq. (21)
-      xi_q = -(1 - 4*b_w*C_BLq/M_PI/in.V)/(1 + 4*b_w*C_BLq/M_PI/in.V) * xi_q_km1
-           + C_BLq/in.V/(1 + 4*b_w*C_BLq/M_PI/in.V) * (xi_w - xi_w_km1); // eq. (23)
-      xi_r = - (1 - 3*b_w*C_BLr/M_PI/in.V)/(1 + 3*b_w*C_BLr/M_PI/in.V) * xi_r_km1
-           + C_BLr/in.V/(1 + 3*b_w*C_BLr/M_PI/in.V) * (xi_v - xi_v_km1); // eq. (25)
+               + 2/sqrt(3.)*omega_w*past.nu_w_km1
+               + (omega_w/sqrt(3.) - C_BL)*past.nu_w_km2); // eq. (20) for w
+      xi_p = -(1 - C_BLp*tau_p)/(1 + C_BLp*tau_p)*past.xi_p_km1
+           + sig_p*sqrt(2*tau_p/T_V)/(1 + C_BLp*tau_p) * (nu_p + past.nu_p_km1); // eq. (21)
+      xi_q = -(1 - 4*b_w*C_BLq/M_PI/in.V)/(1 + 4*b_w*C_BLq/M_PI/in.V) * past.xi_q_km1
+           + C_BLq/in.V/(1 + 4*b_w*C_BLq/M_PI/in.V) * (xi_w - past.xi_w_km1); // eq. (23)
+      xi_r = - (1 - 3*b_w*C_BLr/M_PI/in.V)/(1 + 3*b_w*C_BLr/M_PI/in.V) * past.xi_r_km1
+           + C_BLr/in.V/(1 + 3*b_w*C_BLr/M_PI/in.V) * (xi_v - past.xi_v_km1); // eq. (25)
 
     } else if (turbType == ttMilspec) {
       // the following is the MIL-STD-1797A formulation
       // as cited in Yeager's report
-      xi_u = (1 - T_V/tau_u)  *xi_u_km1 + sig_u*sqrt(2*T_V/tau_u)*nu_u;  // eq. (30)
-      xi_v = (1 - 2*T_V/tau_u)*xi_v_km1 + sig_u*sqrt(4*T_V/tau_u)*nu_v;  // eq. (31)
-      xi_w = (1 - 2*T_V/tau_w)*xi_w_km1 + sig_w*sqrt(4*T_V/tau_w)*nu_w;  // eq. (32)
-      xi_p = (1 - T_V/tau_p)  *xi_p_km1 + sig_p*sqrt(2*T_V/tau_p)*nu_p;  // eq. (33)
-      xi_q = (1 - T_V/tau_q)  *xi_q_km1 + M_PI/4/b_w*(xi_w - xi_w_km1);  // eq. (34)
-      xi_r = (1 - T_V/tau_r)  *xi_r_km1 + M_PI/3/b_w*(xi_v - xi_v_km1);  // eq. (35)
+      xi_u = (1 - T_V/tau_u)  *past.xi_u_km1 + sig_u*sqrt(2*T_V/tau_u)*nu_u;  // eq. (30)
+      xi_v = (1 - 2*T_V/tau_u)*past.xi_v_km1 + sig_u*sqrt(4*T_V/tau_u)*nu_v;  // eq. (31)
+      xi_w = (1 - 2*T_V/tau_w)*past.xi_w_km1 + sig_w*sqrt(4*T_V/tau_w)*nu_w;  // eq. (32)
+      xi_p = (1 - T_V/tau_p)  *past.xi_p_km1 + sig_p*sqrt(2*T_V/tau_p)*nu_p;  // eq. (33)
+      xi_q = (1 - T_V/tau_q)  *past.xi_q_km1 + M_PI/4/b_w*(xi_w - past.xi_w_km1);  // eq. (34)
+      xi_r = (1 - T_V/tau_r)  *past.xi_r_km1 + M_PI/3/b_w*(xi_v - past.xi_v_km1);  // eq. (35)
     }
 
     // rotate by wind azimuth and assign the velocities
@@ -383,12 +409,14 @@ void FGWinds::Turbulence(double h)
     vTurbPQR = in.Tl2b*vTurbPQR;
 
     // hand on the values for the next timestep
-    xi_u_km1 = xi_u; nu_u_km1 = nu_u;
-    xi_v_km2 = xi_v_km1; xi_v_km1 = xi_v; nu_v_km2 = nu_v_km1; nu_v_km1 = nu_v;
-    xi_w_km2 = xi_w_km1; xi_w_km1 = xi_w; nu_w_km2 = nu_w_km1; nu_w_km1 = nu_w;
-    xi_p_km1 = xi_p; nu_p_km1 = nu_p;
-    xi_q_km1 = xi_q;
-    xi_r_km1 = xi_r;
+    past.xi_u_km1 = xi_u; past.nu_u_km1 = nu_u;
+    past.xi_v_km2 = past.xi_v_km1; past.xi_v_km1 = xi_v;
+    past.nu_v_km2 = past.nu_v_km1; past.nu_v_km1 = nu_v;
+    past.xi_w_km2 = past.xi_w_km1; past.xi_w_km1 = xi_w;
+    past.nu_w_km2 = past.nu_w_km1; past.nu_w_km1 = nu_w;
+    past.xi_p_km1 = xi_p; past.nu_p_km1 = nu_p;
+    past.xi_q_km1 = xi_q;
+    past.xi_r_km1 = xi_r;
 
   }
   default:
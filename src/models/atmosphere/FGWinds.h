@@ -179,6 +179,7 @@ public:
                      on a socket for the "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void CopyState(const FGModel& source) override;
   bool InitModel(void) override;
   enum tType {ttNone, ttStandard, ttCulp, ttMilspec, ttTustin} turbType;
 
@@ -397,6 +398,14 @@ private:
   double windspeed_at_20ft; ///< in ft/s
   int probability_of_exceedence_index; ///< this is bound as the severity property
   FGTable *POE_Table; ///< probability of exceedence table
+  /// Past values of the Milspec and Tustin turbulence filters.
+  struct TurbulencePastStates {
+    double xi_u_km1 = 0, nu_u_km1 = 0;
+    double xi_v_km1 = 0, xi_v_km2 = 0, nu_v_km1 = 0, nu_v_km2 = 0;
+    double xi_w_km1 = 0, xi_w_km2 = 0, nu_w_km1 = 0, nu_w_km2 = 0;
+    double xi_p_km1 = 0, nu_p_km1 = 0;
+    double xi_q_km1 = 0, xi_r_km1 = 0;
+  } past;
 
   double psiw;
   FGColumnVector3 vTotalWindNED;
@@ -38,6 +38,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "FGActuator.h"
+#include "FGFCSPipeline.h"
 #include "input_output/FGXMLElement.h"
 #include "math/FGParameterValue.h"
 #include "models/FGFCS.h"
@@ -141,6 +142,28 @@ void FGActuator::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGActuator::CopyState(const FGFCSComponent& source)
+{
+  FGFCSComponent::CopyState(source);
+
+  auto& actuator = static_cast<const FGActuator&>(source);
+  lagVal = actuator.lagVal;
+  ca = actuator.ca;
+  cb = actuator.cb;
+  PreviousOutput = actuator.PreviousOutput;
+  PreviousHystOutput = actuator.PreviousHystOutput;
+  PreviousRateLimOutput = actuator.PreviousRateLimOutput;
+  PreviousLagInput = actuator.PreviousLagInput;
+  PreviousLagOutput = actuator.PreviousLagOutput;
+  fail_zero = actuator.fail_zero;
+  fail_hardover = actuator.fail_hardover;
+  fail_stuck = actuator.fail_stuck;
+  initialized = actuator.initialized;
+  saturated = actuator.saturated;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGActuator::Run(void )
 {
   Input = InputNodes[0]->getDoubleValue();
@@ -192,6 +215,29 @@ bool FGActuator::Run(void )
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Only the actuators with constant parameters and without transport delay can
+// be compiled. The hardover failure requires both clip limits.
+
+bool FGActuator::Compile(FGFCSPipeline& pipeline) const
+{
+  if (delay != 0 || !ClipMin || !ClipMax) return false;
+  if (!ClipMin->IsConstant() || !ClipMax->IsConstant()) return false;
+  if (lag && !lag->IsConstant()) return false;
+  if (rate_limit_incr && !rate_limit_incr->IsConstant()) return false;
+  if (rate_limit_decr && !rate_limit_decr->IsConstant()) return false;
+
+  pipeline.SetOperation(FGFCSPipeline::eActuator,
+                        {lag ? 1.0 : 0.0, ca, cb,
+                         rate_limit_incr ? 1.0 : 0.0,
+                         rate_limit_incr ? rate_limit_incr->GetValue() : 0.0,
+                         rate_limit_decr ? 1.0 : 0.0,
+                         rate_limit_decr ? -rate_limit_decr->GetValue() : 0.0,
+                         dt, deadband_width, hysteresis_width, bias,
+                         ClipMin->GetValue(), ClipMax->GetValue()});
+  return true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGActuator::Bias(void)
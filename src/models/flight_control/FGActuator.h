@@ -137,6 +137,8 @@ public:
       limiting, etc. functions. */
   bool Run (void) override;
   void ResetPastStates(void) override;
+  void CopyState(const FGFCSComponent& source) override;
+  bool Compile(FGFCSPipeline& pipeline) const override;
 
   // these may need to have the bool argument replaced with a double
   /** This function fails the actuator to zero. The motion to zero
@@ -152,6 +154,8 @@ public:
   bool IsSaturated(void) const {return saturated;}
   
 private:
+  friend class FGFCSPipeline;
+
   //double span;
   double bias;
   FGParameter* rate_limit_incr;
@@ -38,6 +38,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "FGDeadBand.h"
+#include "FGFCSPipeline.h"
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 
@@ -102,6 +103,30 @@ bool FGDeadBand::Run(void)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGDeadBand::HasUnlistedInputs(void) const
+{
+  return !Width->IsConstant() || !IsClipConstant();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGDeadBand::IsStateless(void) const
+{
+  return !HasUnlistedInputs();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGDeadBand::Compile(FGFCSPipeline& pipeline) const
+{
+  if (!Width->IsConstant()) return false;
+
+  pipeline.SetOperation(FGFCSPipeline::eDeadBand, {0.5*Width, gain});
+  return true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
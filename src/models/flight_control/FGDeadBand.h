@@ -87,6 +87,9 @@ public:
   ~FGDeadBand();
 
   bool Run(void) override;
+  bool HasUnlistedInputs(void) const override;
+  bool IsStateless(void) const override;
+  bool Compile(FGFCSPipeline& pipeline) const override;
 
 private:
   double gain;
@@ -52,7 +52,7 @@ CLASS IMPLEMENTATION
 FGFCSComponent::FGFCSComponent(FGFCS* _fcs, Element* element) : fcs(_fcs)
 {
   Input = Output = delay_time = 0.0;
-  delay = index = 0;
+  delay = 0;
   ClipMin = ClipMax = new FGRealValue(0.0);
   clip = cyclic_clip = false;
   dt = fcs->GetChannelDeltaT();
@@ -104,6 +104,8 @@ FGFCSComponent::FGFCSComponent(FGFCS* _fcs, Element* element) : fcs(_fcs)
     Type = "ANGLE";
   } else if (element->GetName() == string("distributor")) {
     Type = "DISTRIBUTOR";
+  } else if (element->GetName() == string("delay")) {
+    Type = "DELAY";
   } else { // illegal component in this channel
     Type = "UNKNOWN";
   }
@@ -151,19 +153,20 @@ FGFCSComponent::FGFCSComponent(FGFCS* _fcs, Element* element) : fcs(_fcs)
     FGParameterValue delayParam(delay_str, PropertyManager, delay_elem);
     delay_time = delayParam.GetValue();
     string delayType = delay_elem->GetAttributeValue("type");
+    double frames = 0.0;
     if (delayType.length() > 0) {
       if (delayType == "time") {
-        delay = (unsigned int)(delay_time / dt);
+        frames = delay_time / dt;
       } else if (delayType == "frames") {
-        delay = (unsigned int)delay_time;
+        frames = delay_time;
       } else {
         cerr << "Unallowed delay type" << endl;
       }
     } else {
-      delay = (unsigned int)(delay_time / dt);
+      frames = delay_time / dt;
     }
-    output_array.resize(delay);
-    for (unsigned int i=0; i<delay; i++) output_array[i] = 0.0;
+    DelayLine.SetDelay(frames);
+    delay = (unsigned int)DelayLine.GetDelay();
   }
 
   Element *clip_el = element->FindElement("clipto");
@@ -207,9 +210,19 @@ FGFCSComponent::~FGFCSComponent()
 
 void FGFCSComponent::ResetPastStates(void)
 {
-  index = 0;
-  for (auto &elm: output_array)
-    elm = 0.0;
+  DelayLine.Reset();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSComponent::CopyState(const FGFCSComponent& source)
+{
+  Input = source.Input;
+  Output = source.Output;
+  DelayLine = source.DelayLine;
+
+  // The output nodes can be tied to the variables of other models.
+  SetOutput();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -251,13 +264,10 @@ void FGFCSComponent::Delay(void)
   if (fcs->GetTrimStatus()) {
     // Update the whole history while trim routines are executing.
     // Don't want to model delays while calculating a trim solution.
-    std::fill(output_array.begin(), output_array.end(), Output);
+    DelayLine.Fill(Output);
   }
   else {
-    output_array[index] = Output;
-    if ((unsigned int)index == delay-1) index = 0;
-    else index++;
-    Output = output_array[index];
+    Output = DelayLine.Run(Output);
   }
 }
 
@@ -289,6 +299,13 @@ void FGFCSComponent::Clip(void)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGFCSComponent::IsClipConstant(void) const
+{
+  return !clip || (ClipMin->IsConstant() && ClipMax->IsConstant());
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 // The old way of naming FCS components allowed upper or lower case, spaces,
@@ -356,8 +373,9 @@ void FGFCSComponent::Debug(int from)
         cout << "      Minimum limit: " << ClipMin->GetName() << endl;
         cout << "      Maximum limit: " << ClipMax->GetName() << endl;
       }
-      if (delay > 0) cout <<"      Frame delay: " << delay
-                                   << " frames (" << delay*dt << " sec)" << endl;
+      if (delay > 0) cout <<"      Frame delay: " << DelayLine.GetDelay()
+                          << " frames (" << DelayLine.GetDelay()*dt << " sec)"
+                          << endl;
     }
   }
   if (debug_lvl & 2 ) { // Instantiation/Destruction notification
@@ -39,6 +39,7 @@ INCLUDES
 
 #include "FGJSBBase.h"
 #include "math/FGPropertyValue.h"
+#include "math/FGDelayLine.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -47,6 +48,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGFCS;
+class FGFCSPipeline;
 class Element;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -72,6 +74,7 @@ CLASS DOCUMENTATION
     - FGActuator
     - FGWwaypoint
     - FGAngle
+    - FGDelay
 
     @author Jon S. Berndt
     @see Documentation for the FGFCS class, and for the configuration file class
@@ -96,26 +99,54 @@ public:
   std::string GetType(void) const { return Type; }
   virtual double GetOutputPct(void) const { return 0; }
   virtual void ResetPastStates(void);
+  /** Copies the internal state of a component (see FGFDMExec::Clone()).
+      @param source a component built from the same definition. */
+  virtual void CopyState(const FGFCSComponent& source);
+
+  /// Returns the properties read from the <input> elements of the component.
+  const std::vector<FGPropertyValue_ptr>& GetInputNodes(void) const
+  { return InputNodes; }
+  /// Returns the properties written by the component.
+  const std::vector<FGPropertyNode_ptr>& GetOutputNodes(void) const
+  { return OutputNodes; }
+  /** Determines if the component reads properties that are not listed by its
+      <input> elements: conditions, functions, tables or parameters that are
+      not constant. The dependencies of such a component are unknown so the
+      channels never move it when they sort their components. */
+  virtual bool HasUnlistedInputs(void) const { return true; }
+  /** Determines if the output of the component only depends on the current
+      values of its <input> properties, i.e. the component has no internal
+      state and all its parameters are constant. A channel made of such
+      components is not executed when its inputs are unchanged. */
+  virtual bool IsStateless(void) const { return false; }
+  /** Describes the computation performed by the component to a pipeline.
+      The component calls FGFCSPipeline::SetOperation() if its computation
+      can be performed by one of the pipeline operations.
+      @return false if the component can not be compiled, in which case the
+              pipeline calls its Run() method. */
+  virtual bool Compile(FGFCSPipeline& pipeline) const { return false; }
 
 protected:
+  friend class FGFCSPipeline;
+
   FGFCS* fcs;
   std::vector <FGPropertyNode_ptr> OutputNodes;
   FGParameter_ptr ClipMin, ClipMax;
   std::vector <FGPropertyValue_ptr> InitNodes;
   std::vector <FGPropertyValue_ptr> InputNodes;
-  std::vector <double> output_array;
   std::string Type;
   std::string Name;
   double Input;
   double Output;
   double delay_time;
   unsigned int delay;
-  int index;
+  FGDelayLine DelayLine;
   double dt;
   bool clip, cyclic_clip;
 
   void Delay(void);
   void Clip(void);
+  bool IsClipConstant(void) const;
   void CheckInputNodes(size_t MinNodes, size_t MaxNodes, Element* el);
   virtual void bind(Element* el, FGPropertyManager* pm);
   virtual void Debug(int from);
@@ -0,0 +1,611 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGFCSPipeline.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Executes the compiled components of an FCS channel.
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "FGFCSPipeline.h"
+#include "FGFCSComponent.h"
+#include "FGActuator.h"
+#include "models/FGFCS.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGFCSPipeline::FGFCSPipeline(void)
+{
+  Debug(0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGFCSPipeline::~FGFCSPipeline()
+{
+  Debug(1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSPipeline::Add(FGFCSComponent* component)
+{
+  Operation op;
+  op.type = eRun;
+  op.component = component;
+  op.firstSource = Sources.size();
+  op.numSources = 0;
+  op.firstOutput = Outputs.size();
+  op.numOutputs = 0;
+  op.firstParameter = Parameters.size();
+  op.numParameters = 0;
+  op.bank = -1;
+  op.clip = component->clip;
+  op.cyclicClip = component->cyclic_clip;
+  op.clipMin = op.clipMax = 0.0;
+
+  // A clipping that is not constant or that is ignored at run time (because
+  // its max is lower than its min) is left to the component.
+  bool compile = component->IsClipConstant();
+  if (compile && op.clip) {
+    op.clipMin = component->ClipMin->GetValue();
+    op.clipMax = component->ClipMax->GetValue();
+    compile = op.clipMax >= op.clipMin;
+  }
+
+  Operations.push_back(op);
+  Slots.push_back(0.0);
+
+  if (compile && ResolveSources(component) && component->Compile(*this)) {
+    Operation& compiled = Operations.back();
+    compiled.numSources = Sources.size() - compiled.firstSource;
+    for (auto& output: component->OutputNodes)
+      Outputs.push_back(output);
+    compiled.numOutputs = Outputs.size() - compiled.firstOutput;
+  } else {
+    Operations.back() = op;
+    Sources.resize(op.firstSource);
+    Parameters.resize(op.firstParameter);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The inputs of a component are read from the slot of a preceding operation
+// when that operation is the last one to have written the property and its
+// value is stored as is in the property node (i.e. an untied node of type
+// double which can be read and written). Otherwise they are read from the
+// property node.
+
+bool FGFCSPipeline::ResolveSources(const FGFCSComponent* component)
+{
+  auto PropertyManager = component->fcs->GetPropertyManager();
+
+  for (auto& input: component->InputNodes) {
+    if (input->IsLateBound()) return false;
+
+    Source source;
+    source.node = PropertyManager->GetNode(input->GetFullyQualifiedName());
+    source.slot = 0;
+    source.sign = input->GetSign();
+    if (!source.node) return false;
+
+    bool stored = !source.node->isTied()
+                  && source.node->getType() == simgear::props::DOUBLE
+                  && source.node->getAttribute(SGPropertyNode::READ)
+                  && source.node->getAttribute(SGPropertyNode::WRITE);
+
+    for (size_t i=Operations.size()-1; stored && i > 0; --i) {
+      const Operation& previous = Operations[i-1];
+      if (previous.type == eRun) break;
+
+      bool found = false;
+      for (unsigned int j=0; j<previous.numOutputs; j++)
+        if (Outputs[previous.firstOutput+j] == source.node) found = true;
+
+      if (found) {
+        source.node = nullptr;
+        source.slot = i-1;
+        break;
+      }
+    }
+
+    Sources.push_back(source);
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSPipeline::SetOperation(eOperation type, const vector<double>& parameters)
+{
+  Operation& op = Operations.back();
+  op.type = type;
+  op.numParameters = parameters.size();
+  Parameters.insert(Parameters.end(), parameters.begin(), parameters.end());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Checks that the last of the n operations starting at first does not read
+// the output of the others.
+
+bool FGFCSPipeline::IsIndependent(unsigned int first, unsigned int n) const
+{
+  const Operation& op = Operations[first+n-1];
+
+  for (unsigned int i=0; i<op.numSources; i++) {
+    const Source& source = Sources[op.firstSource+i];
+    for (unsigned int m=first; m<first+n-1; m++) {
+      if (!source.node) {
+        if (source.slot == m) return false;
+        continue;
+      }
+      const Operation& other = Operations[m];
+      for (unsigned int j=0; j<other.numOutputs; j++)
+        if (Outputs[other.firstOutput+j] == source.node) return false;
+    }
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSPipeline::BuildBanks(void)
+{
+  Banks.clear();
+
+  unsigned int n = 0;
+  while (n < Operations.size()) {
+    eOperation type = Operations[n].type;
+
+    switch(type) {
+    case eLagFilter:
+    case eLeadLagFilter:
+    case eSecondOrderFilter:
+    case eWashoutFilter:
+    case eActuator:
+      break;
+    default:
+      ++n;
+      continue;
+    }
+
+    Bank bank;
+    bank.type = type;
+    bank.first = n;
+    bank.size = 1;
+    bank.initialize = true;
+    bank.initialized = false;
+
+    while (n + bank.size < Operations.size()
+           && Operations[n + bank.size].type == type
+           && IsIndependent(n, bank.size + 1))
+      ++bank.size;
+
+    unsigned int numParameters = Operations[n].numParameters;
+    bank.Input.assign(bank.size, 0.0);
+    bank.Output.assign(bank.size, 0.0);
+    bank.Parameters.assign(numParameters, vector<double>(bank.size));
+    bank.States.assign(5, vector<double>(bank.size, 0.0));
+    if (type == eActuator) {
+      bank.FailZero.assign(bank.size, 0);
+      bank.FailHardover.assign(bank.size, 0);
+      bank.FailStuck.assign(bank.size, 0);
+    }
+
+    for (unsigned int i=0; i<bank.size; i++) {
+      const Operation& op = Operations[n+i];
+      for (unsigned int k=0; k<numParameters; k++)
+        bank.Parameters[k][i] = Parameters[op.firstParameter+k];
+    }
+
+    Operations[n].bank = Banks.size();
+    Banks.push_back(bank);
+    n += bank.size;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGFCSPipeline::GetNumCompiled(void) const
+{
+  unsigned int count = 0;
+
+  for (auto& op: Operations)
+    if (op.type != eRun) ++count;
+
+  return count;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSPipeline::ResetPastStates(void)
+{
+  for (auto& bank: Banks) {
+    // Same as FGFilter::ResetPastStates(): the filters are initialized again.
+    // The actuators are not (see FGActuator::ResetPastStates()).
+    bank.initialize = true;
+    for (auto& state: bank.States)
+      std::fill(state.begin(), state.end(), 0.0);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSPipeline::CopyState(const FGFCSPipeline& source)
+{
+  Slots = source.Slots;
+  for (unsigned int i=0; i < Banks.size(); i++) {
+    const Bank& bank = source.Banks[i];
+    Banks[i].initialize = bank.initialize;
+    Banks[i].initialized = bank.initialized;
+    Banks[i].Input = bank.Input;
+    Banks[i].Output = bank.Output;
+    Banks[i].States = bank.States;
+    Banks[i].FailZero = bank.FailZero;
+    Banks[i].FailHardover = bank.FailHardover;
+    Banks[i].FailStuck = bank.FailStuck;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+inline double FGFCSPipeline::GetInput(const Operation& op, unsigned int i) const
+{
+  const Source& source = Sources[op.firstSource+i];
+
+  if (source.node)
+    return source.node->getDoubleValue()*source.sign;
+  else
+    return Slots[source.slot]*source.sign;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Same as FGFCSComponent::Clip() and FGFCSComponent::SetOutput()
+
+void FGFCSPipeline::SetOutput(Operation& op, unsigned int n, double Output)
+{
+  if (op.clip) {
+    double range = op.clipMax - op.clipMin;
+
+    if (op.cyclicClip && range != 0.0) {
+      double value = Output - op.clipMin;
+      Output = fmod(value, range) + op.clipMin;
+      if (Output < op.clipMin)
+        Output += range;
+    }
+    else
+      Output = Constrain(op.clipMin, Output, op.clipMax);
+
+    if (op.type == eActuator) {
+      FGActuator* actuator = static_cast<FGActuator*>(op.component);
+      actuator->saturated = false;
+
+      if (Output >= op.clipMax && op.clipMax != 0)
+        actuator->saturated = true;
+      else if (Output <= op.clipMin && op.clipMin != 0)
+        actuator->saturated = true;
+    }
+  }
+
+  Slots[n] = Output;
+  op.component->Output = Output;
+  for (unsigned int i=0; i<op.numOutputs; i++)
+    Outputs[op.firstOutput+i]->setDoubleValue(Output);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The computations below must be kept identical to the Run() methods of the
+// components.
+
+void FGFCSPipeline::Run(void)
+{
+  for (unsigned int n=0; n<Operations.size(); n++) {
+    Operation& op = Operations[n];
+
+    if (op.bank >= 0) {
+      Bank& bank = Banks[op.bank];
+      if (bank.type == eActuator)
+        RunActuators(bank);
+      else
+        RunFilters(bank);
+      n += bank.size - 1;
+      continue;
+    }
+
+    const double* p = &Parameters[op.firstParameter];
+    double Input, Output = 0.0;
+
+    switch (op.type) {
+    case eRun:
+      op.component->Run();
+      continue;
+    case ePureGain:
+      Output = p[0] * GetInput(op, 0);
+      break;
+    case eAerosurfaceScale:
+      // p = {gain, zero centered, in min, in max, out min, out max}
+      Input = GetInput(op, 0);
+      if (p[1] != 0.0) {
+        if (Input == 0.0) {
+          Output = 0.0;
+        } else if (Input > 0) {
+          Output = (Input / p[3]) * p[5];
+        } else {
+          Output = (Input / p[2]) * p[4];
+        }
+      } else {
+        Output = p[4] + ((Input - p[2]) / (p[3] - p[2])) * (p[5] - p[4]);
+      }
+      Output *= p[0];
+      break;
+    case eSummer:
+      // p = {bias}
+      for (unsigned int i=0; i<op.numSources; i++)
+        Output += GetInput(op, i);
+      Output += p[0];
+      break;
+    case eDeadBand:
+      // p = {half width, gain}
+      Input = GetInput(op, 0);
+      if (Input < -p[0]) {
+        Output = (Input + p[0])*p[1];
+      } else if (Input > p[0]) {
+        Output = (Input - p[0])*p[1];
+      }
+      break;
+    default: // Filters and actuators are executed by their bank.
+      break;
+    }
+
+    SetOutput(op, n, Output);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Same as FGFilter::Run()
+//   Parameters = {ca, cb, cc, cd, ce}
+//   States = {input, previous input 1 & 2, previous output 1 & 2}
+
+void FGFCSPipeline::RunFilters(Bank& bank)
+{
+  Operation* ops = &Operations[bank.first];
+  const unsigned int size = bank.size;
+  const double* ca = bank.Parameters[0].data();
+  const double* cb = bank.Parameters[1].data();
+  const double* cc = bank.Parameters[2].data();
+  const double* cd = bank.Parameters[3].data();
+  const double* ce = bank.Parameters[4].data();
+  double* x = bank.States[0].data();
+  double* x1 = bank.States[1].data();
+  double* x2 = bank.States[2].data();
+  double* y1 = bank.States[3].data();
+  double* y2 = bank.States[4].data();
+  double* y = bank.Output.data();
+
+  if (bank.initialize) {
+    for (unsigned int i=0; i<size; i++)
+      y2[i] = x2[i] = y1[i] = x1[i] = y[i] = x[i];
+    bank.initialize = false;
+  } else {
+    for (unsigned int i=0; i<size; i++)
+      x[i] = GetInput(ops[i], 0);
+
+    switch (bank.type) {
+    case eLagFilter:
+      for (unsigned int i=0; i<size; i++)
+        y[i] = (x[i] + x1[i]) * ca[i] + y1[i] * cb[i];
+      break;
+    case eLeadLagFilter:
+      for (unsigned int i=0; i<size; i++)
+        y[i] = x[i] * ca[i] + x1[i] * cb[i] + y1[i] * cc[i];
+      break;
+    case eSecondOrderFilter:
+      for (unsigned int i=0; i<size; i++)
+        y[i] = x[i] * ca[i] + x1[i] * cb[i] + x2[i] * cc[i]
+                            - y1[i] * cd[i] - y2[i] * ce[i];
+      break;
+    case eWashoutFilter:
+      for (unsigned int i=0; i<size; i++)
+        y[i] = x[i] * ca[i] - x1[i] * ca[i] + y1[i] * cb[i];
+      break;
+    default:
+      break;
+    }
+  }
+
+  for (unsigned int i=0; i<size; i++) {
+    y2[i] = y1[i];
+    y1[i] = y[i];
+    x2[i] = x1[i];
+    x1[i] = x[i];
+  }
+
+  for (unsigned int i=0; i<size; i++)
+    SetOutput(ops[i], bank.first+i, y[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Same as FGActuator::Run()
+//   Parameters = {lag, ca, cb, increasing rate limit, rate, decreasing rate
+//                 limit, -rate, dt, deadband width, hysteresis width, bias,
+//                 hardover min, hardover max}
+//   States = {previous output, previous lag input, previous lag output,
+//             previous rate limited output, previous hysteresis output}
+
+void FGFCSPipeline::RunActuators(Bank& bank)
+{
+  Operation* ops = &Operations[bank.first];
+  const unsigned int size = bank.size;
+  const double* lag = bank.Parameters[0].data();
+  const double* ca = bank.Parameters[1].data();
+  const double* cb = bank.Parameters[2].data();
+  const double* incr = bank.Parameters[3].data();
+  const double* incr_rate = bank.Parameters[4].data();
+  const double* decr = bank.Parameters[5].data();
+  const double* decr_rate = bank.Parameters[6].data();
+  const double* dt = bank.Parameters[7].data();
+  const double* deadband_width = bank.Parameters[8].data();
+  const double* hysteresis_width = bank.Parameters[9].data();
+  const double* bias = bank.Parameters[10].data();
+  const double* hardover_min = bank.Parameters[11].data();
+  const double* hardover_max = bank.Parameters[12].data();
+  double* PreviousOutput = bank.States[0].data();
+  double* PreviousLagInput = bank.States[1].data();
+  double* PreviousLagOutput = bank.States[2].data();
+  double* PreviousRateLimOutput = bank.States[3].data();
+  double* PreviousHystOutput = bank.States[4].data();
+  double* x = bank.Input.data();
+  double* y = bank.Output.data();
+  char* fail_zero = bank.FailZero.data();
+  char* fail_hardover = bank.FailHardover.data();
+  char* fail_stuck = bank.FailStuck.data();
+
+  for (unsigned int i=0; i<size; i++) {
+    const FGActuator* actuator = static_cast<const FGActuator*>(ops[i].component);
+    x[i] = GetInput(ops[i], 0);
+    fail_zero[i] = actuator->fail_zero;
+    fail_hardover[i] = actuator->fail_hardover;
+    fail_stuck[i] = actuator->fail_stuck;
+  }
+
+  if (ops[0].component->fcs->GetTrimStatus()) bank.initialized = false;
+  const bool initialized = bank.initialized;
+
+  for (unsigned int i=0; i<size; i++) {
+    double input = x[i];
+    if (fail_zero[i]) input = 0;
+    if (fail_hardover[i]) input = input < 0.0 ? hardover_min[i] : hardover_max[i];
+
+    double output = input;
+
+    if (fail_stuck[i]) {
+      output = PreviousOutput[i];
+    } else {
+      if (lag[i] != 0.0) {
+        input = output;
+        if (initialized)
+          output = ca[i] * (input + PreviousLagInput[i]) + PreviousLagOutput[i] * cb[i];
+        PreviousLagInput[i] = input;
+        PreviousLagOutput[i] = output;
+      }
+      if (incr[i] != 0.0 || decr[i] != 0.0) {
+        input = output;
+        if (initialized) {
+          double delta = input - PreviousRateLimOutput[i];
+          if (incr[i] != 0.0 && delta > dt[i] * incr_rate[i])
+            output = PreviousRateLimOutput[i] + incr_rate[i] * dt[i];
+          if (decr[i] != 0.0 && delta < dt[i] * decr_rate[i])
+            output = PreviousRateLimOutput[i] + decr_rate[i] * dt[i];
+        }
+        PreviousRateLimOutput[i] = output;
+      }
+      if (deadband_width[i] != 0.0) {
+        input = output;
+        if (input < -deadband_width[i]/2.0)
+          output = (input + deadband_width[i]/2.0);
+        else if (input > deadband_width[i]/2.0)
+          output = (input - deadband_width[i]/2.0);
+        else
+          output = 0.0;
+      }
+      if (hysteresis_width[i] != 0.0) {
+        input = output;
+        if (initialized) {
+          if (input > PreviousHystOutput[i])
+            output = max(PreviousHystOutput[i], input-0.5*hysteresis_width[i]);
+          else if (input < PreviousHystOutput[i])
+            output = min(PreviousHystOutput[i], input+0.5*hysteresis_width[i]);
+        }
+        PreviousHystOutput[i] = output;
+      }
+      if (bias[i] != 0.0)
+        output += bias[i];
+    }
+
+    PreviousOutput[i] = output;
+    y[i] = output;
+  }
+
+  bank.initialized = true;
+
+  for (unsigned int i=0; i<size; i++)
+    SetOutput(ops[i], bank.first+i, y[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//    The bitmasked value choices are as follows:
+//    unset: In this case (the default) JSBSim would only print
+//       out the normally expected messages, essentially echoing
+//       the config files as they are read. If the environment
+//       variable is not set, debug_lvl is set to 1 internally
+//    0: This requests JSBSim not to output any messages
+//       whatsoever.
+//    1: This value explicity requests the normal JSBSim
+//       startup messages
+//    2: This value asks for a message to be printed out when
+//       a class is instantiated
+//    4: When this value is set, a message is displayed when a
+//       FGModel object executes its Run() method
+//    8: When this value is set, various runtime state variables
+//       are printed out periodically
+//    16: When set various parameters are sanity checked and
+//       a message is printed out when they go out of bounds
+
+void FGFCSPipeline::Debug(int from)
+{
+  if (debug_lvl <= 0) return;
+
+  if (debug_lvl & 1) { // Standard console startup message output
+  }
+  if (debug_lvl & 2 ) { // Instantiation/Destruction notification
+    if (from == 0) cout << "Instantiated: FGFCSPipeline" << endl;
+    if (from == 1) cout << "Destroyed:    FGFCSPipeline" << endl;
+  }
+  if (debug_lvl & 4 ) { // Run() method entry print for FGModel-derived objects
+  }
+  if (debug_lvl & 8 ) { // Runtime state variables
+  }
+  if (debug_lvl & 16) { // Sanity checking
+  }
+  if (debug_lvl & 64) {
+    if (from == 0) { // Constructor
+    }
+  }
+}
+}
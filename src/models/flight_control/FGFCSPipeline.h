@@ -0,0 +1,171 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGFCSPipeline.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGFCSPIPELINE_H
+#define FGFCSPIPELINE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+
+#include "FGJSBBase.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFCSComponent;
+class FGPropertyNode;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Compiled form of the components of an FCS channel.
+    The components are executed in the order in which they are added. The
+    components that support it (see FGFCSComponent::Compile()) are translated
+    into an operation whose parameters are stored in contiguous arrays and
+    whose inputs are resolved once for all to a property node or, when the
+    input is computed by a preceding operation of the pipeline, to the slot
+    where that operation stores its result. The other components are executed
+    by calling their Run() method.
+
+    The filters and the actuators are grouped in <i>banks</i>: consecutive
+    filters of the same type (or consecutive actuators) which do not read the
+    output of each other are stepped together. The states and parameters of a
+    bank are stored as structures of arrays so that the loops over the bank
+    members can be vectorized by the compiler. The inputs of all the members
+    are read before the first one is computed, which is equivalent to the
+    sequential execution since the members are independent.
+
+    The operations perform exactly the same computations as the Run() method
+    of the components so the results are identical. Their outputs are still
+    written to the properties of the components (so they can be read by the
+    other models, the scripts and the outputs) and to the component itself so
+    that FGFCSComponent::GetOutput() is kept up to date.
+  */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGFCSPipeline : public FGJSBBase
+{
+public:
+  /// The operations that the components can be compiled to.
+  enum eOperation {eRun=0, ePureGain, eAerosurfaceScale, eSummer, eDeadBand,
+                   eLagFilter, eLeadLagFilter, eSecondOrderFilter,
+                   eWashoutFilter, eActuator};
+
+  /// Constructor
+  FGFCSPipeline(void);
+  /// Destructor
+  ~FGFCSPipeline();
+
+  /** Appends a component to the pipeline.
+      The component is compiled if possible, otherwise its Run() method is
+      called when the pipeline is executed. */
+  void Add(FGFCSComponent* component);
+  /** Defines the operation of the component being added.
+      This method is meant to be called by FGFCSComponent::Compile().
+      @param op the operation performed by the component
+      @param parameters the parameters of the operation */
+  void SetOperation(eOperation op, const std::vector<double>& parameters);
+  /** Groups the filters and actuators in banks. It must be called once all
+      the components have been added. */
+  void BuildBanks(void);
+  /// Executes the components.
+  void Run(void);
+  /// Resets the past states of the compiled operations.
+  void ResetPastStates(void);
+  /// Copies the past states of the operations of an identical pipeline.
+  void CopyState(const FGFCSPipeline& source);
+  /// Returns the number of components that have been compiled.
+  unsigned int GetNumCompiled(void) const;
+  /// Returns the number of banks.
+  unsigned int GetNumBanks(void) const { return Banks.size(); }
+
+private:
+  // Either a property node (when node is not null) or the result of a
+  // preceding operation.
+  struct Source {
+    FGPropertyNode* node;
+    unsigned int slot;
+    double sign;
+  };
+
+  struct Operation {
+    eOperation type;
+    FGFCSComponent* component;
+    unsigned int firstSource, numSources;
+    unsigned int firstOutput, numOutputs;
+    unsigned int firstParameter, numParameters;
+    int bank;     // index of the bank that starts with this operation or -1
+    bool clip, cyclicClip;
+    double clipMin, clipMax;
+  };
+
+  // The members of a bank are the operations [first, first+size[. Each of
+  // the vectors of Parameters and States holds one value per member.
+  struct Bank {
+    eOperation type;
+    unsigned int first, size;
+    bool initialize;   // filters: the first step initializes the past states
+    bool initialized;  // actuators: past states are available
+    std::vector<double> Input, Output;
+    std::vector<std::vector<double> > Parameters;
+    std::vector<std::vector<double> > States;
+    std::vector<char> FailZero, FailHardover, FailStuck;
+  };
+
+  std::vector<Operation> Operations;
+  std::vector<Source> Sources;
+  std::vector<FGPropertyNode*> Outputs;
+  std::vector<double> Parameters;
+  std::vector<double> Slots; // results of the operations
+  std::vector<Bank> Banks;
+
+  double GetInput(const Operation& op, unsigned int i) const;
+  bool ResolveSources(const FGFCSComponent* component);
+  bool IsIndependent(unsigned int first, unsigned int n) const;
+  void RunFilters(Bank& bank);
+  void RunActuators(Bank& bank);
+  void SetOutput(Operation& op, unsigned int n, double Output);
+  void Debug(int from);
+};
+}
+#endif
@@ -38,6 +38,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "FGFilter.h"
+#include "FGFCSPipeline.h"
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 
@@ -91,6 +92,22 @@ void FGFilter::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFilter::CopyState(const FGFCSComponent& source)
+{
+  FGFCSComponent::CopyState(source);
+
+  auto& filter = static_cast<const FGFilter&>(source);
+  Initialize = filter.Initialize;
+  ca = filter.ca; cb = filter.cb; cc = filter.cc; cd = filter.cd;
+  ce = filter.ce;
+  PreviousInput1 = filter.PreviousInput1;
+  PreviousInput2 = filter.PreviousInput2;
+  PreviousOutput1 = filter.PreviousOutput1;
+  PreviousOutput2 = filter.PreviousOutput2;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFilter::ReadFilterCoefficients(Element* element, int index,
                                       std::shared_ptr<FGPropertyManager> PropertyManager)
 {
@@ -191,6 +208,36 @@ bool FGFilter::Run(void)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGFilter::HasUnlistedInputs(void) const
+{
+  for (unsigned int i=1; i<7; i++)
+    if (C[i] && !C[i]->IsConstant()) return true;
+
+  return !IsClipConstant();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGFilter::Compile(FGFCSPipeline& pipeline) const
+{
+  FGFCSPipeline::eOperation op;
+
+  if (DynamicFilter) return false;
+
+  switch (FilterType) {
+    case eLag:      op = FGFCSPipeline::eLagFilter;         break;
+    case eLeadLag:  op = FGFCSPipeline::eLeadLagFilter;     break;
+    case eOrder2:   op = FGFCSPipeline::eSecondOrderFilter; break;
+    case eWashout:  op = FGFCSPipeline::eWashoutFilter;     break;
+    default:        return false;
+  }
+
+  pipeline.SetOperation(op, {ca, cb, cc, cd, ce});
+  return true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
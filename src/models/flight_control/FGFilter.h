@@ -219,8 +219,11 @@ public:
   ~FGFilter();
 
   bool Run (void) override;
+  bool HasUnlistedInputs(void) const override;
+  bool Compile(FGFCSPipeline& pipeline) const override;
 
   void ResetPastStates(void) override;
+  void CopyState(const FGFCSComponent& source) override;
 
 private:
   bool DynamicFilter;
@@ -38,6 +38,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "FGGain.h"
+#include "FGFCSPipeline.h"
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 #include "math/FGTable.h"
@@ -171,6 +172,39 @@ bool FGGain::Run(void )
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGGain::HasUnlistedInputs(void) const
+{
+  return Table || !Gain->IsConstant() || !IsClipConstant();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGGain::IsStateless(void) const
+{
+  return !HasUnlistedInputs();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGGain::Compile(FGFCSPipeline& pipeline) const
+{
+  if (!Gain->IsConstant()) return false;
+
+  if (Type == "PURE_GAIN") {
+    pipeline.SetOperation(FGFCSPipeline::ePureGain, {Gain->GetValue()});
+    return true;
+  } else if (Type == "AEROSURFACE_SCALE") {
+    pipeline.SetOperation(FGFCSPipeline::eAerosurfaceScale,
+                          {Gain->GetValue(), ZeroCentered ? 1.0 : 0.0,
+                           InMin, InMax, OutMin, OutMax});
+    return true;
+  }
+
+  return false;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -221,6 +221,9 @@ public:
   ~FGGain();
 
   bool Run (void) override;
+  bool HasUnlistedInputs(void) const override;
+  bool IsStateless(void) const override;
+  bool Compile(FGFCSPipeline& pipeline) const override;
 
 private:
   FGTable* Table;
@@ -130,6 +130,7 @@ public:
       @return false on success, true on failure.
       The routine doing the work.  */
   bool Run (void) override;
+  bool HasUnlistedInputs(void) const override;
 
 private:
   std::vector<double> Detents;
@@ -217,6 +217,25 @@ bool FGLinearActuator::Run(void )
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLinearActuator::CopyState(const FGFCSComponent& source)
+{
+  FGFCSComponent::CopyState(source);
+
+  auto& actuator = static_cast<const FGLinearActuator&>(source);
+  set = actuator.set;
+  reset = actuator.reset;
+  direction = actuator.direction;
+  countSpin = actuator.countSpin;
+  versus = actuator.versus;
+  bias = actuator.bias;
+  inputLast = actuator.inputLast;
+  inputMem = actuator.inputMem;
+  previousLagInput = actuator.previousLagInput;
+  previousLagOutput = actuator.previousLagOutput;
+}
+
 // %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -229,6 +229,7 @@ public:
 
   /// The execution method for this FCS component.
   bool Run(void) override;
+  void CopyState(const FGFCSComponent& source) override;
         
 private:
   FGParameter_ptr ptrSet;
@@ -109,6 +109,21 @@ void FGMagnetometer::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGMagnetometer::CopyState(const FGFCSComponent& source)
+{
+  FGSensor::CopyState(source);
+
+  auto& magnetometer = static_cast<const FGMagnetometer&>(source);
+  vMag = magnetometer.vMag;
+  for (int i=0; i < 6; i++) field[i] = magnetometer.field[i];
+  usedLat = magnetometer.usedLat;
+  usedLon = magnetometer.usedLon;
+  usedAlt = magnetometer.usedAlt;
+  counter = magnetometer.counter;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGMagnetometer::updateInertialMag(void)
 {
   if (counter++ % INERTIAL_UPDATE_RATE == 0)//dont need to update every iteration
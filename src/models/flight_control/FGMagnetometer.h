@@ -126,6 +126,7 @@ public:
 
   bool Run (void) override;
   void ResetPastStates(void) override;
+  void CopyState(const FGFCSComponent& source) override;
 
 private:
   std::shared_ptr<FGPropagate> Propagate;
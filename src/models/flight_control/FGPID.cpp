@@ -151,6 +151,18 @@ void FGPID::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGPID::CopyState(const FGFCSComponent& source)
+{
+  FGFCSComponent::CopyState(source);
+
+  auto& pid = static_cast<const FGPID&>(source);
+  I_out_total = pid.I_out_total;
+  Input_prev = pid.Input_prev;
+  Input_prev2 = pid.Input_prev2;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGPID::Run(void )
 {
   double I_out_delta = 0.0;
@@ -139,6 +139,22 @@ void FGSensor::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGSensor::CopyState(const FGFCSComponent& source)
+{
+  FGFCSComponent::CopyState(source);
+
+  auto& sensor = static_cast<const FGSensor&>(source);
+  drift = sensor.drift;
+  PreviousOutput = sensor.PreviousOutput;
+  PreviousInput = sensor.PreviousInput;
+  quantized = sensor.quantized;
+  fail_low = sensor.fail_low;
+  fail_high = sensor.fail_high;
+  fail_stuck = sensor.fail_stuck;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGSensor::Run(void)
 {
   Input = InputNodes[0]->getDoubleValue();
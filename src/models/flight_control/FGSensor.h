@@ -113,8 +113,9 @@ If the type is ABSOLUTE, then the noise number times the random number is added
 to the input signal instead of being multiplied against it as with the PERCENT
 type of noise.
 
-The delay element can specify a frame delay. The integer number provided is the
-number of frames to delay the output signal.
+The delay element can specify a frame delay. The number provided is the number
+of frames to delay the output signal. A delay that is not a whole number of
+frames is interpolated between the two surrounding frames (see FGDelayLine).
 
 @author Jon S. Berndt
 @version $Revision: 1.24 $
@@ -141,6 +142,7 @@ public:
 
   bool Run (void) override;
   void ResetPastStates(void) override;
+  void CopyState(const FGFCSComponent& source) override;
 
 protected:
   enum eNoiseType {ePercent=0, eAbsolute} NoiseType;
@@ -111,6 +111,9 @@ public:
 
   /// The execution method for this FCS component.
   bool Run(void) override;
+  bool HasUnlistedInputs(void) const override;
+  bool IsStateless(void) const override;
+  bool Compile(FGFCSPipeline& pipeline) const override;
 
 private:
   double Bias;
@@ -87,11 +87,10 @@ FGSwitch::FGSwitch(FGFCS* fcs, Element* element) : FGFCSComponent(fcs, element)
     value = test_element->GetAttributeValue("value");
     current_test->setTestValue(value, Name, PropertyManager, test_element);
     current_test->Default = true;
-    if (delay > 0 && is_number(value)) {        // If there is a delay, initialize the
-      for (unsigned int i=0; i<delay-1; i++) {  // delay buffer to the default value
-        output_array[i] = atof(value.c_str());  // for the switch if that value is a number.
-      }
-    }
+    // If there is a delay, initialize the delay buffer to the default value
+    // for the switch if that value is a number.
+    if (delay > 0 && is_number(value))
+      DelayLine.Fill(atof(value.c_str()));
     tests.push_back(current_test);
   }
 
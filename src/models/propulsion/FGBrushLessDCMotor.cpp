@@ -177,6 +177,26 @@ void FGBrushLessDCMotor::Calculate(void)
   RunPostFunctions();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBrushLessDCMotor::CopyState(const FGEngine& source)
+{
+  FGEngine::CopyState(source);
+
+  auto& motor = static_cast<const FGBrushLessDCMotor&>(source);
+  RPM = motor.RPM;
+  HP = motor.HP;
+  V = motor.V;
+  DeltaRPM = motor.DeltaRPM;
+  MaxTorque = motor.MaxTorque;
+  TorqueAvailable = motor.TorqueAvailable;
+  TargetTorque = motor.TargetTorque;
+  TorqueRequired = motor.TorqueRequired;
+  CurrentRequired = motor.CurrentRequired;
+  EnginePower = motor.EnginePower;
+  InertiaTorque = motor.InertiaTorque;
+}
+
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -90,6 +90,7 @@ public:
   ~FGBrushLessDCMotor();
 
   void Calculate(void);
+  void CopyState(const FGEngine& source) override;
   double GetPowerAvailable(void) {return (HP * hptoftlbssec);}
   double GetCurrentRequired(void) {return CurrentRequired;}
   double getRPM(void) {return RPM;}
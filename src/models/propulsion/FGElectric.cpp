@@ -107,6 +107,17 @@ void FGElectric::Calculate(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGElectric::CopyState(const FGEngine& source)
+{
+  FGEngine::CopyState(source);
+
+  auto& electric = static_cast<const FGElectric&>(source);
+  RPM = electric.RPM;
+  HP = electric.HP;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGElectric::CalcFuelNeed(void)
 {
   return 0;
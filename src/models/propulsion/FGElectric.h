@@ -73,6 +73,7 @@ public:
   ~FGElectric();
 
   void Calculate(void);
+  void CopyState(const FGEngine& source) override;
   double GetPowerAvailable(void) {return (HP * hptoftlbssec);}
   double getRPM(void) {return RPM;}
   std::string GetEngineLabels(const std::string& delimiter);
@@ -90,6 +90,28 @@ void FGEngine::ResetToIC(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGEngine::CopyState(const FGEngine& source)
+{
+  CopyFunctionValues(source);
+  MaxThrottle = source.MaxThrottle;
+  MinThrottle = source.MinThrottle;
+  FuelExpended = source.FuelExpended;
+  FuelFlowRate = source.FuelFlowRate;
+  PctPower = source.PctPower;
+  Starter = source.Starter;
+  Starved = source.Starved;
+  Running = source.Running;
+  Cranking = source.Cranking;
+  FuelFreeze = source.FuelFreeze;
+  FuelFlow_gph = source.FuelFlow_gph;
+  FuelFlow_pph = source.FuelFlow_pph;
+  FuelUsedLbs = source.FuelUsedLbs;
+  FuelDensity = source.FuelDensity;
+  Thruster->CopyState(*source.Thruster);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGEngine::CalcFuelNeed(void)
 {
   FuelFlowRate = SLFuelFlowMax*PctPower;
@@ -167,6 +167,11 @@ public:
   /** Resets the Engine parameters to the initial conditions */
   virtual void ResetToIC(void);
 
+  /** Copies the state of the engine and of its thruster (see
+      FGFDMExec::Clone()).
+      @param source an engine built from the same definition. */
+  virtual void CopyState(const FGEngine& source);
+
   /** Calculates the thrust of the engine, and other engine functions. */
   virtual void Calculate(void) = 0;
 
@@ -94,6 +94,20 @@ const FGColumnVector3& FGForce::GetBodyForces(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGForce::CopyState(const FGForce& source)
+{
+  vFn = source.vFn;
+  vMn = source.vMn;
+  vOrient = source.vOrient;
+  vXYZn = source.vXYZn;
+  vActingXYZn = source.vActingXYZn;
+  mT = source.mT;
+  vFb = source.vFb;
+  vM = source.vM;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 const FGMatrix33& FGForce::Transform(void) const
 {
   switch(ttype) {
@@ -231,6 +231,9 @@ public:
   enum TransformType { tNone, tWindBody, tLocalBody, tCustom };
 
   virtual const FGColumnVector3& GetBodyForces(void);
+  /** Copies the state of a force (see FGFDMExec::Clone()).
+      @param source a force built from the same definition. */
+  virtual void CopyState(const FGForce& source);
 
   inline double GetBodyXForce(void) const { return vFb(eX); }
   inline double GetBodyYForce(void) const { return vFb(eY); }
@@ -472,6 +472,46 @@ void FGPiston::ResetToIC(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGPiston::CopyState(const FGEngine& source)
+{
+  FGEngine::CopyState(source);
+
+  auto& piston = static_cast<const FGPiston&>(source);
+  crank_counter = piston.crank_counter;
+  IndicatedHorsePower = piston.IndicatedHorsePower;
+  PMEP = piston.PMEP;
+  FMEP = piston.FMEP;
+  BoostSpeed = piston.BoostSpeed;
+  MAP = piston.MAP;
+  TMAP = piston.TMAP;
+  p_amb = piston.p_amb;
+  p_ram = piston.p_ram;
+  T_amb = piston.T_amb;
+  RPM = piston.RPM;
+  IAS = piston.IAS;
+  Magneto_Left = piston.Magneto_Left;
+  Magneto_Right = piston.Magneto_Right;
+  Magnetos = piston.Magnetos;
+  rho_air = piston.rho_air;
+  volumetric_efficiency_reduced = piston.volumetric_efficiency_reduced;
+  m_dot_air = piston.m_dot_air;
+  v_dot_air = piston.v_dot_air;
+  equivalence_ratio = piston.equivalence_ratio;
+  m_dot_fuel = piston.m_dot_fuel;
+  HP = piston.HP;
+  BoostLossHP = piston.BoostLossHP;
+  combustion_efficiency = piston.combustion_efficiency;
+  ExhaustGasTemp_degK = piston.ExhaustGasTemp_degK;
+  EGT_degC = piston.EGT_degC;
+  ManifoldPressure_inHg = piston.ManifoldPressure_inHg;
+  CylinderHeadTemp_degK = piston.CylinderHeadTemp_degK;
+  OilPressure_psi = piston.OilPressure_psi;
+  OilTemp_degK = piston.OilTemp_degK;
+  MeanPistonSpeed_fps = piston.MeanPistonSpeed_fps;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGPiston::Calculate(void)
 {
   // Input values.
@@ -236,6 +236,7 @@ public:
   double CalcFuelNeed(void);
 
   void ResetToIC(void);
+  void CopyState(const FGEngine& source) override;
   void SetMagnetos(int magnetos) {Magnetos = magnetos;}
 
   double  GetEGT(void) const { return EGT_degC; }
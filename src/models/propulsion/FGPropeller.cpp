@@ -35,6 +35,7 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -66,6 +67,8 @@ FGPropeller::FGPropeller(FGFDMExec* exec, Element* prop_element, int num)
   GearRatio = 1.0;
   CtFactor = CpFactor = 1.0;
   ConstantSpeed = 0;
+  GridThrustCoeff = 0.0;
+  LastCell[0] = LastCell[1] = LastCell[2] = 0;
   cThrust = cPower = CtMach = CpMach = 0;
   Vinduced = 0.0;
 
@@ -136,6 +139,10 @@ FGPropeller::FGPropeller(FGFDMExec* exec, Element* prop_element, int num)
   if (prop_element->FindElement("cp_factor"))
     SetCpFactor( prop_element->FindElementValueAsNumber("cp_factor") );
 
+  if (prop_element->FindElement("precompute")
+      && prop_element->FindElementValueAsNumber("precompute") != 0.0)
+    PrecomputeCoefficients();
+
   Type = ttPropeller;
   RPM = 0;
   vTorque.InitMatrix();
@@ -193,6 +200,26 @@ void FGPropeller::ResetToIC(void)
   Vinduced = 0.0;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropeller::CopyState(const FGForce& source)
+{
+  FGThruster::CopyState(source);
+
+  auto& propeller = static_cast<const FGPropeller&>(source);
+  J = propeller.J;
+  RPM = propeller.RPM;
+  Pitch = propeller.Pitch;
+  Advance = propeller.Advance;
+  ExcessTorque = propeller.ExcessTorque;
+  HelicalTipMach = propeller.HelicalTipMach;
+  Vinduced = propeller.Vinduced;
+  vTorque = propeller.vTorque;
+  Reversed = propeller.Reversed;
+  Reverse_coef = propeller.Reverse_coef;
+  Feathered = propeller.Feathered;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 // We must be getting the aerodynamic velocity here, NOT the inertial velocity.
@@ -212,7 +239,7 @@ double FGPropeller::Calculate(double EnginePower)
   // Simualtion (3rd edition)" eqn 8.2-1
   // Variables in.AeroUVW and in.AeroPQR include the wind and turbulence effects
   // as computed by FGAuxiliary.
-  FGColumnVector3 localAeroVel = mT.Transposed() * (in.AeroUVW + in.AeroPQR*vDXYZ);
+  FGColumnVector3 localAeroVel = mT.TransposedProduct(in.AeroUVW + in.AeroPQR*vDXYZ);
   double omega, PowerAvailable;
 
   double Vel = localAeroVel(eU);
@@ -229,17 +256,22 @@ double FGPropeller::Calculate(double EnginePower)
 
   PowerAvailable = EnginePower - GetPowerRequired();
 
-  if (MaxPitch == MinPitch) {    // Fixed pitch prop
-    ThrustCoeff = cThrust->GetValue(J);
-  } else {                       // Variable pitch prop
-    ThrustCoeff = cThrust->GetValue(J, Pitch);
-  }
+  if (HasPrecomputedCoefficients()) {
+    // Ct has been looked up along with Cp by GetPowerRequired()
+    ThrustCoeff = GridThrustCoeff * CtFactor;
+  } else {
+    if (MaxPitch == MinPitch) {    // Fixed pitch prop
+      ThrustCoeff = cThrust->GetValue(J);
+    } else {                       // Variable pitch prop
+      ThrustCoeff = cThrust->GetValue(J, Pitch);
+    }
 
-  // Apply optional scaling factor to Ct (default value = 1)
-  ThrustCoeff *= CtFactor;
+    // Apply optional scaling factor to Ct (default value = 1)
+    ThrustCoeff *= CtFactor;
 
-  // Apply optional Mach effects from CT_MACH table
-  if (CtMach) ThrustCoeff *= CtMach->GetValue(HelicalTipMach);
+    // Apply optional Mach effects from CT_MACH table
+    if (CtMach) ThrustCoeff *= CtMach->GetValue(HelicalTipMach);
+  }
 
   Thrust = ThrustCoeff*RPS*RPS*D4*rho;
 
@@ -303,10 +335,7 @@ double FGPropeller::GetPowerRequired(void)
 {
   double cPReq;
 
-  if (MaxPitch == MinPitch) {   // Fixed pitch prop
-    cPReq = cPower->GetValue(J);
-
-  } else {                      // Variable pitch prop
+  if (MaxPitch != MinPitch) {   // Variable pitch prop
 
     if (ConstantSpeed != 0) {   // Constant Speed Mode
 
@@ -348,15 +377,23 @@ double FGPropeller::GetPowerRequired(void)
     } else { // Manual Pitch Mode, pitch is controlled externally
 
     }
-
-    cPReq = cPower->GetValue(J, Pitch);
   }
 
-  // Apply optional scaling factor to Cp (default value = 1)
-  cPReq *= CpFactor;
+  if (HasPrecomputedCoefficients()) {
+    LookupCoefficients(J, Pitch, HelicalTipMach, GridThrustCoeff, cPReq);
+    cPReq *= CpFactor;
+  } else {
+    if (MaxPitch == MinPitch)   // Fixed pitch prop
+      cPReq = cPower->GetValue(J);
+    else                        // Variable pitch prop
+      cPReq = cPower->GetValue(J, Pitch);
 
-  // Apply optional Mach effects from CP_MACH table
-  if (CpMach) cPReq *= CpMach->GetValue(HelicalTipMach);
+    // Apply optional scaling factor to Cp (default value = 1)
+    cPReq *= CpFactor;
+
+    // Apply optional Mach effects from CP_MACH table
+    if (CpMach) cPReq *= CpMach->GetValue(HelicalTipMach);
+  }
 
   double RPS = RPM / 60.0;
   double local_RPS = RPS < 0.01 ? 0.01 : RPS; 
@@ -366,6 +403,160 @@ double FGPropeller::GetPowerRequired(void)
   return PowerRequired;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The tables are interpolated linearly between their breakpoints and are
+// clamped beyond, so they are piecewise multilinear functions of (J, pitch,
+// Mach). Sampling them at the union of their breakpoints gives a grid whose
+// multilinear interpolation reproduces the product of the tables exactly.
+
+void FGPropeller::PrecomputeCoefficients(void)
+{
+  if (!cThrust || !cPower) return;
+
+  auto AddRowKeys = [](const FGTable* table, vector<double>& keys) {
+    for (unsigned int r=1; r<=table->GetNumRows(); r++)
+      keys.push_back(table->GetElement(r, 0));
+  };
+  auto AddColumnKeys = [](const FGTable* table, vector<double>& keys) {
+    for (unsigned int c=1; c<=table->GetNumColumns(); c++)
+      keys.push_back(table->GetElement(0, c));
+  };
+  auto SortKeys = [](vector<double>& keys) {
+    sort(keys.begin(), keys.end());
+    keys.erase(unique(keys.begin(), keys.end()), keys.end());
+  };
+
+  GridJ.clear();
+  GridPitch.clear();
+  GridMach.clear();
+
+  AddRowKeys(cThrust, GridJ);
+  AddRowKeys(cPower, GridJ);
+  if (IsVPitch()) {
+    AddColumnKeys(cThrust, GridPitch);
+    AddColumnKeys(cPower, GridPitch);
+  } else
+    GridPitch.push_back(MinPitch);
+  if (CtMach) AddRowKeys(CtMach, GridMach);
+  if (CpMach) AddRowKeys(CpMach, GridMach);
+  if (GridMach.empty()) GridMach.push_back(0.0);
+
+  SortKeys(GridJ);
+  SortKeys(GridPitch);
+  SortKeys(GridMach);
+
+  LastCell[0] = LastCell[1] = LastCell[2] = 0;
+
+  GridValues.clear();
+  GridValues.reserve(2*GridJ.size()*GridPitch.size()*GridMach.size());
+
+  for (double mach: GridMach) {
+    for (double pitch: GridPitch) {
+      for (double j: GridJ) {
+        double ct, cp;
+        if (IsVPitch()) {
+          ct = cThrust->GetValue(j, pitch);
+          cp = cPower->GetValue(j, pitch);
+        } else {
+          ct = cThrust->GetValue(j);
+          cp = cPower->GetValue(j);
+        }
+        if (CtMach) ct *= CtMach->GetValue(mach);
+        if (CpMach) cp *= CpMach->GetValue(mach);
+        GridValues.push_back(ct);
+        GridValues.push_back(cp);
+      }
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Locates a key in the grid breakpoints. The keys beyond the breakpoints are
+// clamped like FGTable does. The cell found by the previous call is checked
+// first since the operating point usually moves slowly from a time step to the
+// next.
+
+static void FindCell(const vector<double>& keys, double key, size_t& last,
+                     size_t& i0, size_t& i1, double& factor)
+{
+  if (keys.size() < 2 || key <= keys.front()) {
+    i0 = i1 = 0;
+    factor = 0.0;
+  } else if (key >= keys.back()) {
+    i0 = i1 = keys.size()-1;
+    factor = 0.0;
+  } else {
+    if (key < keys[last] || key >= keys[last+1])
+      last = upper_bound(keys.begin(), keys.end(), key) - keys.begin() - 1;
+    i0 = last;
+    i1 = last + 1;
+    factor = (key - keys[i0]) / (keys[i1] - keys[i0]);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Trilinear interpolation of Ct and Cp, the cell and the weights are shared by
+// both coefficients.
+
+void FGPropeller::LookupCoefficients(double j, double pitch, double mach,
+                                     double& ct, double& cp) const
+{
+  size_t j0, j1, p0, p1, m0, m1;
+  double fj, fp, fm;
+
+  FindCell(GridJ, j, LastCell[0], j0, j1, fj);
+  FindCell(GridPitch, pitch, LastCell[1], p0, p1, fp);
+  FindCell(GridMach, mach, LastCell[2], m0, m1, fm);
+
+  const size_t nj = GridJ.size(), np = GridPitch.size();
+  const double* v00 = &GridValues[2*((m0*np + p0)*nj)];
+  const double* v01 = &GridValues[2*((m0*np + p1)*nj)];
+  const double* v10 = &GridValues[2*((m1*np + p0)*nj)];
+  const double* v11 = &GridValues[2*((m1*np + p1)*nj)];
+  double c[2];
+
+  for (unsigned int k=0; k<2; k++) {
+    double c00 = v00[2*j0+k] + fj*(v00[2*j1+k] - v00[2*j0+k]);
+    double c01 = v01[2*j0+k] + fj*(v01[2*j1+k] - v01[2*j0+k]);
+    double c10 = v10[2*j0+k] + fj*(v10[2*j1+k] - v10[2*j0+k]);
+    double c11 = v11[2*j0+k] + fj*(v11[2*j1+k] - v11[2*j0+k]);
+    double c0 = c00 + fp*(c01 - c00);
+    double c1 = c10 + fp*(c11 - c10);
+    c[k] = c0 + fm*(c1 - c0);
+  }
+
+  ct = c[0];
+  cp = c[1];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropeller::GetCoefficients(size_t n, const double* J, const double* pitch,
+                                  const double* mach, double* Ct,
+                                  double* Cp) const
+{
+  for (size_t i=0; i<n; i++) {
+    double ct, cp;
+
+    if (HasPrecomputedCoefficients())
+      LookupCoefficients(J[i], pitch[i], mach[i], ct, cp);
+    else {
+      if (IsVPitch()) {
+        ct = cThrust->GetValue(J[i], pitch[i]);
+        cp = cPower->GetValue(J[i], pitch[i]);
+      } else {
+        ct = cThrust->GetValue(J[i]);
+        cp = cPower->GetValue(J[i]);
+      }
+      if (CtMach) ct *= CtMach->GetValue(mach[i]);
+      if (CpMach) cp *= CpMach->GetValue(mach[i]);
+    }
+
+    Ct[i] = ct * CtFactor;
+    Cp[i] = cp * CpFactor;
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGColumnVector3 FGPropeller::GetPFactor() const
@@ -448,6 +639,9 @@ void FGPropeller::Debug(int from)
       cout << "      Maximum Pitch  = " << MaxPitch << endl;
       cout << "      Minimum RPM  = " << MinRPM << endl;
       cout << "      Maximum RPM  = " << MaxRPM << endl;
+      if (HasPrecomputedCoefficients())
+        cout << "      Precomputed coefficients: " << GridJ.size() << " x "
+             << GridPitch.size() << " x " << GridMach.size() << " grid" << endl;
 // Tables are being printed elsewhere...
 //      cout << "      Thrust Coefficient: " <<  endl;
 //      cThrust->Print();
@@ -72,6 +72,7 @@ CLASS DOCUMENTATION
   <reversepitch> {number} </reversepitch>
   <ct_factor> {number} </ct_factor>
   <cp_factor> {number} </cp_factor>
+  <precompute> {0 | 1} </precompute>
 
   <table name="C_THRUST" type="internal">
     <tableData>
@@ -120,6 +121,9 @@ CLASS DOCUMENTATION
                        the propeller.
     \<ct_factor>     - A multiplier for the coefficients of thrust.
     \<cp_factor>     - A multiplier for the coefficients of power.
+    \<precompute>    - 1 = the coefficients are looked up in a precomputed grid
+                       (see PrecomputeCoefficients()), 0 = the coefficients are
+                       looked up in the tables (default).
 </pre>
 
 Two tables are needed. One for coefficient of thrust (Ct) and one for
@@ -180,6 +184,7 @@ public:
 
   /// Reset the initial conditions.
   void ResetToIC(void);
+  void CopyState(const FGForce& source) override;
 
   /** Sets the Revolutions Per Minute for the propeller. Normally the propeller
       instance will calculate its own rotational velocity, given the Torque
@@ -259,6 +264,32 @@ public:
   /// Retrieves propeller power Mach effects factor
   FGTable* GetCpMachTable(void) const { return CpMach; }
 
+  /** Bakes the thrust and power coefficients, including the Mach effects of
+      the CT_MACH and CP_MACH tables, in a single grid indexed by the advance
+      ratio, the blade angle and the helical tip Mach number. Both coefficients
+      are then obtained with one interpolation per time step. Since the grid
+      contains all the breakpoints of the tables, the interpolated values are
+      the same as those of the tables. This method must be called again if the
+      tables are modified. */
+  void PrecomputeCoefficients(void);
+
+  /// Returns true if the coefficients are looked up in the precomputed grid.
+  bool HasPrecomputedCoefficients(void) const { return !GridValues.empty(); }
+
+  /** Computes the thrust and power coefficients for a batch of operating
+      points, for instance to trim the aircraft or to generate performance
+      tables. The coefficients include the Mach effects and the Ct and Cp
+      factors. The precomputed grid is used when it is available.
+      @param n the number of operating points
+      @param J the advance ratios
+      @param pitch the blade angles in degrees (ignored by fixed pitch
+                   propellers)
+      @param mach the helical tip Mach numbers
+      @param Ct the thrust coefficients (output)
+      @param Cp the power coefficients (output) */
+  void GetCoefficients(size_t n, const double* J, const double* pitch,
+                       const double* mach, double* Ct, double* Cp) const;
+
   /// Retrieves the Torque in foot-pounds (Don't you love the English system?)
   double GetTorque(void) const  { return vTorque(eX); }
 
@@ -335,6 +366,14 @@ private:
   double CtFactor;
   double CpFactor;
   int    ConstantSpeed;
+  // Precomputed coefficients: breakpoints and (Ct, Cp) pairs stored with the
+  // advance ratio varying fastest.
+  std::vector<double> GridJ, GridPitch, GridMach;
+  std::vector<double> GridValues;
+  double GridThrustCoeff;
+  mutable size_t LastCell[3];
+  void LookupCoefficients(double j, double pitch, double mach,
+                          double& ct, double& cp) const;
   void Debug(int from);
   double ReversePitch; // Pitch, when fully reversed
   bool   Reversed;     // true, when propeller is reversed
@@ -212,6 +212,31 @@ void FGRocket::Calculate(void)
   RunPostFunctions();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRocket::CopyState(const FGEngine& source)
+{
+  FGEngine::CopyState(source);
+
+  auto& rocket = static_cast<const FGRocket&>(source);
+  Isp = rocket.Isp;
+  It = rocket.It;
+  ItVac = rocket.ItVac;
+  MxR = rocket.MxR;
+  BurnTime = rocket.BurnTime;
+  ThrustVariation = rocket.ThrustVariation;
+  TotalIspVariation = rocket.TotalIspVariation;
+  VacThrust = rocket.VacThrust;
+  previousFuelNeedPerTank = rocket.previousFuelNeedPerTank;
+  previousOxiNeedPerTank = rocket.previousOxiNeedPerTank;
+  OxidizerExpended = rocket.OxidizerExpended;
+  TotalPropellantExpended = rocket.TotalPropellantExpended;
+  SLOxiFlowMax = rocket.SLOxiFlowMax;
+  OxidizerFlowRate = rocket.OxidizerFlowRate;
+  PropellantFlowRate = rocket.PropellantFlowRate;
+  Flameout = rocket.Flameout;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // 
 // The FuelFlowRate can be affected by the TotalIspVariation value (settable
@@ -136,6 +136,7 @@ public:
 
   /** Determines the thrust.*/
   void Calculate(void);
+  void CopyState(const FGEngine& source) override;
 
   /** The fuel need is calculated based on power levels and flow rate for that
       power level. It is also turned from a rate into an actual amount (pounds)
@@ -47,6 +47,7 @@ INCLUDES
 #include <sstream>
 
 #include "FGRotor.h"
+#include "models/FGAtmosphere.h"
 #include "models/FGMassBalance.h"
 #include "models/FGPropulsion.h" // to get the GearRatio from a linked rotor
 #include "input_output/FGXMLElement.h"
@@ -81,6 +82,8 @@ FGRotor::FGRotor(FGFDMExec *exec, Element* rotor_element, int num)
     BladeFlappingMoment(0.0), BladeMassMoment(0.0), PolarMoment(0.0),
     InflowLag(0.0), TipLossB(0.0),
     GroundEffectExp(0.0), GroundEffectShift(0.0), GroundEffectScaleNorm(1.0),
+    BladeElementMode(false), StallAngle(0.0), ProfileDragCoeff(0.0),  // blade-element model
+    DragCoeffAlpha2(0.0), DragDivergenceMach(0.0), MachRefFactor(1.0),
     LockNumberByRho(0.0), Solidity(0.0),            // derived parameters
     RPM(0.0), Omega(0.0),                           // dynamic values
     beta_orient(0.0),
@@ -338,6 +341,12 @@ double FGRotor::Configure(Element* rotor_element)
   LockNumberByRho = LiftCurveSlope * BladeChord * R[4] / BladeFlappingMoment;
   Solidity = BladeNum * BladeChord / (M_PI * Radius);
 
+  // the blade-element model can also be selected at run time, so it is
+  // always configured.
+  Element* be_element = rotor_element->FindElement("bladeelement");
+  BladeElementMode = be_element != nullptr;
+  ConfigureBladeElements(be_element);
+
   // estimate inflow lag, see /GE49/ eqn(1)
   double omega_tmp = (NominalRPM/60.0)*2.0*M_PI;
   estimate = 16.0/(LockNumberByRho*rho * omega_tmp ); // 16/(gamma*Omega)
@@ -350,6 +359,57 @@ double FGRotor::Configure(Element* rotor_element)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+// Setup of the radial stations (midpoint rule, the stations beyond the tip loss
+// factor do not produce any load) and of the azimuth positions.
+
+void FGRotor::ConfigureBladeElements(Element* be_element)
+{
+  int stations = (int) ConfigValue(be_element, "stations", 12);
+  stations = (int) Constrain(1.0, (double)stations, 1000.0);
+
+  int azimuths = (int) ConfigValue(be_element, "azimuths", 24);
+  azimuths = (int) Constrain(1.0, (double)azimuths, 3600.0);
+
+  double root_cutout = ConfigValueConv(be_element, "rootcutout", HingeOffset, "FT");
+  root_cutout = Constrain(0.0, root_cutout/Radius, 0.9);
+
+  StallAngle = ConfigValueConv(be_element, "stallangle", 12.0*degtorad, "RAD");
+  StallAngle = Constrain(1e-3, StallAngle, 0.5*M_PI);
+  ProfileDragCoeff = ConfigValue(be_element, "cd0", 0.009);
+  DragCoeffAlpha2 = ConfigValue(be_element, "cd2", 0.3);
+  DragDivergenceMach = ConfigValue(be_element, "dragdivergencemach", 0.75);
+
+  // The lift curve slope is the value of the section at 3/4 radius at the
+  // nominal RPM and sea level: the Prandtl-Glauert factor is applied relative to
+  // the Mach number of that section.
+  double mach_ref = 0.75 * (NominalRPM/60.0)*2.0*M_PI * Radius
+                    / FGAtmosphere::StdDaySLsoundspeed;
+  MachRefFactor = sqrt(1.0 - sqr(std::min(mach_ref, 0.9)));
+
+  double width = (1.0 - root_cutout) / stations;
+
+  StationX.resize(stations);
+  StationWidth.resize(stations);
+  StationTwist.resize(stations);
+  for (int i=0; i<stations; i++) {
+    double x = root_cutout + (i + 0.5) * width;
+    StationX[i] = x;
+    // fraction of the station inboard of the tip loss factor
+    StationWidth[i] = Constrain(0.0, TipLossB - (x - 0.5*width), width);
+    StationTwist[i] = BladeTwist * x;
+  }
+
+  SinPsi.resize(azimuths);
+  CosPsi.resize(azimuths);
+  for (int j=0; j<azimuths; j++) {
+    double psi = 2.0 * M_PI * j / azimuths;
+    SinPsi[j] = sin(psi);
+    CosPsi[j] = cos(psi);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 // calculate control-axes components of total airspeed at the hub.
 // sets rotor orientation angle (beta) as side effect. /SH79/ eqn(19-22)
 
@@ -539,6 +599,106 @@ void FGRotor::calc_torque(double theta_0)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+// Inflow for the blade-element model: same integration as calc_flow_and_thrust()
+// but driven by the thrust coefficient of the previous time step.
+
+void FGRotor::calc_inflow(double Uw, double Ww, double flow_scale)
+{
+  double c0;
+
+  mu = Uw/(Omega*Radius); // /SH79/ eqn(24)
+  if (mu > 0.7) mu = 0.7;
+
+  c0 = C_T / ( 2.0 * sqrt( sqr(mu) + sqr(lambda) ) + 1e-15);
+
+  nu  = flow_scale * ((nu - c0) * exp(-dt/InflowLag) + c0);
+
+  lambda = Ww/(Omega*Radius) - nu; // /SH79/ eqn(25)
+
+  v_induced = nu * (Omega*Radius);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Integrates the section loads over the rotor disk. The azimuth psi is measured
+// from the downstream direction in the control axes, where the blade pitch has
+// no cyclic component, and the blade flaps with
+//   beta = a0 - a_1*cos(psi) - b_1*sin(psi).
+// The velocities are made non-dimensional with the tip speed: ut is the
+// velocity that meets the leading edge and up the upward velocity of the air
+// with respect to the blade. The loads of the sections are summed per azimuth
+// position in the inner loop, so that it only runs over the station arrays.
+
+void FGRotor::calc_blade_element_loads(double theta_0)
+{
+  const size_t stations = StationX.size();
+  const size_t azimuths = SinPsi.size();
+  const double tip_mach = Omega*Radius / in.Soundspeed;
+  const double* x = StationX.data();
+  const double* width = StationWidth.data();
+  const double* twist = StationTwist.data();
+
+  double thrust = 0.0, torque = 0.0, h_drag = 0.0, j_side = 0.0;
+
+  for (size_t j=0; j<azimuths; j++) {
+    const double s = SinPsi[j], c = CosPsi[j];
+    const double beta = a0 - a_1*c - b_1*s;
+    const double dbeta = a_1*s - b_1*c;  // d(beta)/d(psi)
+    const double ut0 = mu*s;
+    const double up0 = lambda - mu*beta*c;
+
+    double f_up = 0.0, f_tan = 0.0, m_tan = 0.0;
+
+    for (size_t i=0; i<stations; i++) {
+      const double ut = x[i] + ut0;
+      const double up = up0 - x[i]*dbeta;
+      const double u = sqrt(ut*ut + up*up);
+      const double mach = u*tip_mach;
+
+      double alpha = theta_0 + twist[i] + atan2(up, ut);
+      if (alpha > M_PI) alpha -= 2.0*M_PI;
+      else if (alpha < -M_PI) alpha += 2.0*M_PI;
+
+      double cl, cd;
+      if (fabs(alpha) < StallAngle) {
+        cl = LiftCurveSlope * alpha * MachRefFactor / sqrt(1.0 - sqr(std::min(mach, 0.9)));
+        cd = ProfileDragCoeff + DragCoeffAlpha2 * alpha*alpha;
+      } else { // flat plate
+        cl = sin(2.0*alpha);
+        cd = ProfileDragCoeff + 2.0*sqr(sin(alpha));
+      }
+      if (mach > DragDivergenceMach)
+        cd += 20.0*sqr(sqr(mach - DragDivergenceMach));
+
+      // lift is normal and drag parallel to the local velocity
+      const double w = u * width[i];
+      const double ft = w * (cl*up - cd*ut);
+      f_up  += w * (cl*ut + cd*up);
+      f_tan += ft;
+      m_tan += ft * x[i];
+    }
+
+    // the normal force is tilted inward by the flapping angle
+    thrust += f_up;
+    torque -= m_tan;
+    h_drag -= f_tan*s + beta*f_up*c;
+    j_side += f_tan*c - beta*f_up*s;
+  }
+
+  // dimensional loads, averaged over the azimuth positions
+  double k = 0.5 * rho * BladeChord * sqr(Omega*Radius) * Radius * BladeNum
+             / azimuths;
+
+  Thrust = k * thrust;
+  H_drag = k * h_drag;
+  J_side = k * j_side;
+  Torque = k * Radius * torque;
+
+  C_T = Thrust / (rho * M_PI * R[2] * sqr(Omega*Radius));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 // Get the downwash angles with respect to the shaft axis.
 // Given a 'regular'  main rotor, the angles are zero when the downwash points
 // down, positive theta values mean that the downwash turns towards the nose,
@@ -646,15 +806,29 @@ void FGRotor::CalcRotorState(void)
 
   avFus_ca = fus_angvel_body2ca(in.AeroPQR);
 
-  calc_flow_and_thrust(theta_col, vHub_ca(eU), vHub_ca(eW), ge_factor);
+  if (BladeElementMode) {
+
+    calc_inflow(vHub_ca(eU), vHub_ca(eW), ge_factor);
+
+    calc_coning_angle(theta_col);
+
+    calc_flapping_angles(theta_col, avFus_ca);
 
-  calc_coning_angle(theta_col);
+    calc_blade_element_loads(theta_col);
 
-  calc_flapping_angles(theta_col, avFus_ca);
+  } else {
+
+    calc_flow_and_thrust(theta_col, vHub_ca(eU), vHub_ca(eW), ge_factor);
+
+    calc_coning_angle(theta_col);
+
+    calc_flapping_angles(theta_col, avFus_ca);
 
-  calc_drag_and_side_forces(theta_col);
+    calc_drag_and_side_forces(theta_col);
 
-  calc_torque(theta_col);
+    calc_torque(theta_col);
+
+  }
 
   calc_downwash_angles();
 
@@ -687,6 +861,43 @@ double FGRotor::Calculate(double EnginePower)
   return Thrust;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRotor::CopyState(const FGForce& source)
+{
+  FGThruster::CopyState(source);
+
+  auto& rotor = static_cast<const FGRotor&>(source);
+  dt = rotor.dt;
+  rho = rotor.rho;
+  damp_hagl = rotor.damp_hagl;
+  InvTransform = rotor.InvTransform;
+  RPM = rotor.RPM;
+  Omega = rotor.Omega;
+  beta_orient = rotor.beta_orient;
+  a0 = rotor.a0;
+  a_1 = rotor.a_1;
+  b_1 = rotor.b_1;
+  a_dw = rotor.a_dw;
+  a1s = rotor.a1s;
+  b1s = rotor.b1s;
+  H_drag = rotor.H_drag;
+  J_side = rotor.J_side;
+  Torque = rotor.Torque;
+  C_T = rotor.C_T;
+  lambda = rotor.lambda;
+  mu = rotor.mu;
+  nu = rotor.nu;
+  v_induced = rotor.v_induced;
+  theta_downwash = rotor.theta_downwash;
+  phi_downwash = rotor.phi_downwash;
+  CollectiveCtrl = rotor.CollectiveCtrl;
+  LateralCtrl = rotor.LateralCtrl;
+  LongitudinalCtrl = rotor.LongitudinalCtrl;
+  EngineRPM = rotor.EngineRPM;
+  if (Transmission) Transmission->CopyState(*rotor.Transmission);
+}
+
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -735,6 +946,10 @@ bool FGRotor::bindmodel(FGPropertyManager* PropertyManager)
   property_name = base_property_name + "/phi-downwash-rad";
   PropertyManager->Tie( property_name.c_str(), this, &FGRotor::GetPhiDW );
 
+  property_name = base_property_name + "/blade-element-mode";
+  PropertyManager->Tie( property_name.c_str(), this, &FGRotor::GetBladeElementMode,
+                                                     &FGRotor::SetBladeElementMode );
+
   property_name = base_property_name + "/groundeffect-scale-norm";
   PropertyManager->Tie( property_name.c_str(), this, &FGRotor::GetGroundEffectScaleNorm,
                                                      &FGRotor::SetGroundEffectScaleNorm );
@@ -875,6 +1090,15 @@ void FGRotor::Debug(int from)
       }
       cout << "      Control Mapping = " << ControlMapName << endl;
 
+      if (BladeElementMode) {
+        cout << "      Blade-element model: " << StationX.size() << " stations, "
+             << SinPsi.size() << " azimuths" << endl;
+        cout << "        Stall Angle = " << StallAngle << " rad" << endl;
+        cout << "        Drag Coefficient = " << ProfileDragCoeff << " + "
+             << DragCoeffAlpha2 << " alpha^2" << endl;
+        cout << "        Drag Divergence Mach = " << DragDivergenceMach << endl;
+      }
+
     }
   }
   if (debug_lvl & 2 ) { // Instantiation/Destruction notification
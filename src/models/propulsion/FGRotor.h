@@ -41,6 +41,8 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <vector>
+
 #include "FGThruster.h"
 #include "FGTransmission.h"
 
@@ -85,6 +87,16 @@ CLASS DOCUMENTATION
   <groundeffectexp> {number} </groundeffectexp>
   <groundeffectshift unit="{LENGTH}"> {number} </groundeffectshift>
 
+  <bladeelement>
+    <stations> {number} </stations>
+    <azimuths> {number} </azimuths>
+    <rootcutout unit="{LENGTH}"> {number} </rootcutout>
+    <stallangle unit="{ANGLE}"> {number} </stallangle>
+    <cd0> {number} </cd0>
+    <cd2> {number} </cd2>
+    <dragdivergencemach> {number} </dragdivergencemach>
+  </bladeelement>
+
 </rotor>
 
 //  LENGTH means any of the supported units, same for ANGLE and MOMENT.
@@ -137,6 +149,19 @@ CLASS DOCUMENTATION
     \<groundeffectshift>  - Further adjustment of ground effect, approx. hub height or slightly above
                             (This lessens the influence of the ground effect).
 
+    \<bladeelement>       - Selects the blade-element model (see notes), optional.
+      \<stations>         - Number of radial stations per blade, defaults to 12.
+      \<azimuths>         - Number of azimuth positions per revolution, defaults to 24.
+      \<rootcutout>       - Inboard end of the lifting part of the blade, defaults to
+                              the hinge offset.
+      \<stallangle>       - Section angle of attack at which the blade stalls, defaults
+                              to 12 deg.
+      \<cd0>              - Section profile drag coefficient, defaults to 0.009.
+      \<cd2>              - Increase of the section drag coefficient with the square of the
+                              angle of attack, defaults to 0.3.
+      \<dragdivergencemach> - Section Mach number above which compressibility increases
+                              the drag, defaults to 0.75.
+
 </pre>
 
 <h3>Notes:</h3>
@@ -200,6 +225,26 @@ CLASS DOCUMENTATION
     scaling of the ground effect influence. For instance the effect vanishes at speeds
     above approx. 50kts, or one likes to land on a 'perforated' helipad.
 
+  <h4>- Blade-element model -</h4>
+
+    By default the thrust, the in-plane forces and the torque are given by the closed
+    form expressions of /SH79/, which assume a linear lift curve and cannot capture the
+    stall of the retreating blade nor the compressibility effects on the advancing
+    blade. When the <tt>\<bladeelement></tt> element is present, these loads are
+    instead integrated over the radial stations and the azimuth positions of the blades
+    at each time step. The section lift coefficient follows the lift curve slope up to
+    the stall angle and the values of a flat plate beyond (including the reverse flow
+    region). The lift curve slope is corrected by the Prandtl-Glauert factor with
+    respect to the section at 3/4 radius, at the nominal RPM and at sea level, so that
+    the value given by <tt>\<liftcurveslope></tt> keeps its meaning. The section drag
+    coefficient includes a compressibility drag rise above the drag divergence Mach
+    number. The inflow, the coning and the flapping angles are still computed as
+    described in /SH79/ and the fuselage angular rates only act through the flapping
+    angles.
+
+    The property <tt>propulsion/engine[x]/blade-element-mode</tt> allows switching
+    between both models at run time.
+
   <h4>- Development hints -</h4>
 
     Setting <tt>\<ExternalRPM> -1 \</ExternalRPM></tt> the rotor's RPM is controlled  by
@@ -252,6 +297,7 @@ public:
 
   /// Returns the scalar thrust of the rotor, and adjusts the RPM value.
   double Calculate(double EnginePower);
+  void CopyState(const FGForce& source) override;
 
 
   /// Retrieves the RPMs of the rotor.
@@ -291,6 +337,11 @@ public:
   /// Downwash angle - positive values point leftward (given a horizontal spinning rotor)
   double GetPhiDW(void) const { return phi_downwash; }
 
+  /// Returns true if the loads are computed with the blade-element model.
+  bool GetBladeElementMode(void) const { return BladeElementMode; }
+  /// Selects the blade-element model or the closed form model of /SH79/.
+  void SetBladeElementMode(bool mode) { BladeElementMode = mode; }
+
   /// Retrieves the ground effect scaling factor.
   double GetGroundEffectScaleNorm(void) const { return GroundEffectScaleNorm; }
   /// Sets the ground effect scaling factor.
@@ -324,6 +375,7 @@ private:
                                   bool tell=false);
 
   double Configure(Element* rotor_element);
+  void ConfigureBladeElements(Element* be_element);
 
   void CalcRotorState(void);
 
@@ -335,6 +387,10 @@ private:
   void calc_torque(double theta_0);
   void calc_downwash_angles();
 
+  // blade-element model
+  void calc_inflow(double Uw, double Ww, double flow_scale = 1.0);
+  void calc_blade_element_loads(double theta_0);
+
   // transformations
   FGColumnVector3 hub_vel_body2ca( const FGColumnVector3 &uvw, const FGColumnVector3 &pqr, 
                                    double a_ic = 0.0 , double b_ic = 0.0 );
@@ -381,6 +437,20 @@ private:
   double GroundEffectShift;
   double GroundEffectScaleNorm;
 
+  // blade-element model, the radial stations and the azimuth positions
+  // are stored as separate arrays that are swept by the inner loops.
+  bool   BladeElementMode;
+  double StallAngle;
+  double ProfileDragCoeff;
+  double DragCoeffAlpha2;
+  double DragDivergenceMach;
+  double MachRefFactor;
+  std::vector<double> StationX;     // station radius / Radius
+  std::vector<double> StationWidth; // station width / Radius, 0 beyond tip loss
+  std::vector<double> StationTwist; // local twist (rad)
+  std::vector<double> SinPsi;       // azimuth positions
+  std::vector<double> CosPsi;
+
   // derived parameters
   double LockNumberByRho;
   double Solidity; // aka sigma
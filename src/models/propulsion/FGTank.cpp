@@ -251,6 +251,28 @@ void FGTank::ResetToIC(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGTank::CopyState(const FGTank& source)
+{
+  vXYZ = source.vXYZ;
+  UnusableVol = source.UnusableVol;
+  InnerRadius = source.InnerRadius;
+  Length = source.Length;
+  Volume = source.Volume;
+  Density = source.Density;
+  Ixx = source.Ixx;
+  Iyy = source.Iyy;
+  Izz = source.Izz;
+  PctFull = source.PctFull;
+  Contents = source.Contents;
+  Temperature = source.Temperature;
+  Standpipe = source.Standpipe;
+  ExternalFlow = source.ExternalFlow;
+  Selected = source.Selected;
+  Priority = source.Priority;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 FGColumnVector3 FGTank::GetXYZ(void) const
 {
   return vXYZ_drain + (Contents/Capacity)*(vXYZ - vXYZ_drain);
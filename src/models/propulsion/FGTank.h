@@ -245,6 +245,10 @@ public:
   /** Resets the tank parameters to the initial conditions */
   void ResetToIC(void);
 
+  /** Copies the state of the tank (see FGFDMExec::Clone()).
+      @param source a tank built from the same definition. */
+  void CopyState(const FGTank& source);
+
   /** If the tank is set to supply fuel, this function returns true.
       @return true if this tank is set to a non-zero priority.*/
   bool GetSelected(void) const {return Selected;}
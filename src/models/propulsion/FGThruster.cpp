@@ -134,6 +134,20 @@ void FGThruster::ResetToIC(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGThruster::CopyState(const FGForce& source)
+{
+  FGForce::CopyState(source);
+
+  auto& thruster = static_cast<const FGThruster&>(source);
+  in = thruster.in;
+  Thrust = thruster.Thrust;
+  PowerRequired = thruster.PowerRequired;
+  ThrustCoeff = thruster.ThrustCoeff;
+  ReverserAngle = thruster.ReverserAngle;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGThruster::GetThrusterLabels(int id, const string& delimeter)
 {
   std::ostringstream buf;
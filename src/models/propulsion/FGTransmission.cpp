@@ -135,6 +135,22 @@ void FGTransmission::Calculate(double EnginePower, double ThrusterTorque, double
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGTransmission::CopyState(const FGTransmission& source)
+{
+  FreeWheelLag = source.FreeWheelLag;
+  FreeWheelTransmission = source.FreeWheelTransmission;
+  ThrusterMoment = source.ThrusterMoment;
+  EngineMoment = source.EngineMoment;
+  EngineFriction = source.EngineFriction;
+  ClutchCtrlNorm = source.ClutchCtrlNorm;
+  BrakeCtrlNorm = source.BrakeCtrlNorm;
+  MaxBrakePower = source.MaxBrakePower;
+  EngineRPM = source.EngineRPM;
+  ThrusterRPM = source.ThrusterRPM;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGTransmission::BindModel(int num, FGPropertyManager* PropertyManager)
 {
   string property_name, base_property_name;
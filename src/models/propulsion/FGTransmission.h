@@ -119,6 +119,10 @@ public:
 
   void Calculate(double EnginePower, double ThrusterTorque, double dt);
 
+  /** Copies the state of the transmission (see FGFDMExec::Clone()).
+      @param source a transmission built from the same definition. */
+  void CopyState(const FGTransmission& source);
+
   void   SetMaxBrakePower(double x) {MaxBrakePower=x;}
   double GetMaxBrakePower() const {return MaxBrakePower;}
   void   SetEngineFriction(double x) {EngineFriction=x;}
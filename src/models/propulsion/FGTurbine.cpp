@@ -100,6 +100,44 @@ void FGTurbine::ResetToIC(void)
   OilTemp_degK = in.TAT_c + 273.0;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurbine::CopyState(const FGEngine& source)
+{
+  FGEngine::CopyState(source);
+
+  auto& turbine = static_cast<const FGTurbine&>(source);
+  phase = turbine.phase;
+  N1 = turbine.N1;
+  N2 = turbine.N2;
+  N2norm = turbine.N2norm;
+  N1_factor = turbine.N1_factor;
+  N2_factor = turbine.N2_factor;
+  ThrottlePos = turbine.ThrottlePos;
+  AugmentCmd = turbine.AugmentCmd;
+  Stalled = turbine.Stalled;
+  Seized = turbine.Seized;
+  Overtemp = turbine.Overtemp;
+  Fire = turbine.Fire;
+  Injection = turbine.Injection;
+  Augmentation = turbine.Augmentation;
+  Reversed = turbine.Reversed;
+  Cutoff = turbine.Cutoff;
+  Ignition = turbine.Ignition;
+  EGT_degC = turbine.EGT_degC;
+  EPR = turbine.EPR;
+  OilPressure_psi = turbine.OilPressure_psi;
+  OilTemp_degK = turbine.OilTemp_degK;
+  BleedDemand = turbine.BleedDemand;
+  InletPosition = turbine.InletPosition;
+  NozzlePosition = turbine.NozzlePosition;
+  correctedTSFC = turbine.correctedTSFC;
+  InjectionTimer = turbine.InjectionTimer;
+  InjWaterNorm = turbine.InjWaterNorm;
+  InjN1increment = turbine.InjN1increment;
+  InjN2increment = turbine.InjN2increment;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // The main purpose of Calculate() is to determine what phase the engine should
 // be in, then call the corresponding function.
@@ -236,6 +236,7 @@ public:
 
   int InitRunning(void);
   void ResetToIC(void);
+  void CopyState(const FGEngine& source) override;
 
   std::string GetEngineLabels(const std::string& delimiter);
   std::string GetEngineValues(const std::string& delimiter);
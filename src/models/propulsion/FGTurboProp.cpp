@@ -287,6 +287,34 @@ void FGTurboProp::Calculate(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGTurboProp::CopyState(const FGEngine& source)
+{
+  FGEngine::CopyState(source);
+
+  auto& turboprop = static_cast<const FGTurboProp&>(source);
+  phase = turboprop.phase;
+  N1 = turboprop.N1;
+  ThrottlePos = turboprop.ThrottlePos;
+  Reversed = turboprop.Reversed;
+  Cutoff = turboprop.Cutoff;
+  OilPressure_psi = turboprop.OilPressure_psi;
+  OilTemp_degK = turboprop.OilTemp_degK;
+  Ielu_intervent = turboprop.Ielu_intervent;
+  OldThrottle = turboprop.OldThrottle;
+  RPM = turboprop.RPM;
+  PSFC = turboprop.PSFC;
+  CombustionEfficiency = turboprop.CombustionEfficiency;
+  HP = turboprop.HP;
+  StartTime = turboprop.StartTime;
+  Eng_ITT_degC = turboprop.Eng_ITT_degC;
+  Eng_Temperature = turboprop.Eng_Temperature;
+  EngStarting = turboprop.EngStarting;
+  GeneratorPower = turboprop.GeneratorPower;
+  Condition = turboprop.Condition;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGTurboProp::Off(void)
 {
   Running = false; EngStarting = false;
@@ -101,6 +101,7 @@ public:
   enum phaseType { tpOff, tpRun, tpSpinUp, tpStart, tpTrim };
 
   void Calculate(void);
+  void CopyState(const FGEngine& source) override;
   double CalcFuelNeed(void);
 
   double GetPowerAvailable(void) const { return (HP * hptoftlbssec); }
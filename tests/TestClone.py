@@ -0,0 +1,111 @@
+# TestClone.py
+#
+# Check that FGFDMExec::Clone() produces an executive that gives the same
+# results as the original.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import math
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+properties = ('simulation/sim-time-sec', 'position/h-sl-ft',
+              'position/lat-geod-deg', 'position/long-gc-deg',
+              'velocities/vc-kts', 'attitude/phi-deg', 'attitude/theta-deg',
+              'attitude/psi-deg', 'propulsion/engine/engine-rpm',
+              'propulsion/tank/contents-lbs')
+
+
+class TestClone(JSBSimTestCase):
+    def initialize(self):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm.load_ic('reset01', True)
+        fdm['fcs/throttle-cmd-norm'] = 0.7
+        fdm['fcs/mixture-cmd-norm'] = 1.0
+        fdm.run_ic()
+        return fdm
+
+    def test_clone_after_ic(self):
+        fdm = self.initialize()
+        clone = fdm.clone()
+        self.assertIsNotNone(clone)
+
+        for i in range(1000):
+            fdm.run()
+            clone.run()
+
+        for prop in properties:
+            self.assertEqual(fdm[prop], clone[prop], msg=prop)
+
+        # The clone has its own property tree.
+        clone['fcs/throttle-cmd-norm'] = 0.2
+        self.assertEqual(fdm['fcs/throttle-cmd-norm'], 0.7)
+
+    def test_clone_while_running(self):
+        fdm = self.initialize()
+        for i in range(1000):
+            fdm.run()
+
+        clone = fdm.clone()
+        self.assertEqual(fdm.get_sim_time(), clone.get_sim_time())
+
+        # The clone copies the internal states of the models (engine, flight
+        # control components, landing gears, etc.) so both executives must
+        # give exactly the same results.
+        catalog = [p.split(' ')[0] for p in fdm.get_property_catalog('')]
+        # The number of location updates depends on the validity of the
+        # cached values and the output functions are not evaluated since the
+        # output is disabled in the clone.
+        excluded = ('simulation/vehicle-location-updates',
+                    'velocities/pi-deg_sec')
+        catalog = [p for p in catalog if p not in excluded]
+
+        for i in range(100):
+            for prop in catalog:
+                if math.isnan(fdm[prop]):
+                    self.assertTrue(math.isnan(clone[prop]), msg=prop)
+                else:
+                    self.assertEqual(fdm[prop], clone[prop], msg=prop)
+            fdm.run()
+            clone.run()
+
+    def test_clone_scheduler(self):
+        fdm = self.create_fdm()
+        fdm['simulation/scheduler/aerodynamics/rate'] = 2
+        fdm['simulation/scheduler/systems/substeps'] = 4
+        fdm.load_model('c172x')
+        fdm.load_ic('reset01', True)
+        fdm.run_ic()
+
+        # The schedule must be set up before the clone loads the aircraft.
+        clone = fdm.clone()
+        self.assertEqual(clone['simulation/scheduler/aerodynamics/rate'], 2)
+        self.assertEqual(clone['simulation/scheduler/systems/substeps'], 4)
+
+        for i in range(100):
+            fdm.run()
+            clone.run()
+
+        for prop in properties:
+            self.assertEqual(fdm[prop], clone[prop], msg=prop)
+
+    def test_no_model(self):
+        fdm = self.create_fdm()
+        self.assertIsNone(fdm.clone())
+
+
+RunTest(TestClone)
@@ -0,0 +1,62 @@
+# TestDelay.py
+#
+# Check the transport delays of the FCS components and the <delay> component.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest, FlightModel
+
+
+class TestDelay(JSBSimTestCase):
+    def delayed(self, history, frames):
+        # The frame being executed counts as the first frame of the delay.
+        lag = frames - 1
+        n = int(lag)
+        x0 = history[-1-n] if n < len(history) else 0.0
+        x1 = history[-2-n] if n+1 < len(history) else 0.0
+        return x0 + (lag - n)*(x1 - x0)
+
+    def test_delay(self):
+        tripod = FlightModel(self, 'tripod')
+        tripod.include_system_test_file('delay.xml')
+        fdm = tripod.start()
+        self.assertAlmostEqual(fdm['simulation/dt'], 1./120.)
+
+        history = []
+        for i in range(30):
+            v = 0.1*i*i
+            history.append(v)
+            fdm['test/input'] = v
+            fdm.run()
+            self.assertEqual(fdm['test/frames'], self.delayed(history, 4))
+            # 0.05 s at 120 Hz
+            self.assertEqual(fdm['test/time'], self.delayed(history, 6))
+            self.assertAlmostEqual(fdm['test/fraction'],
+                                   max(-self.delayed(history, 2.5), -10.0))
+            self.assertEqual(fdm['test/output'], fdm['test/fraction'])
+            self.assertAlmostEqual(fdm['test/actuator'],
+                                   self.delayed(history, 1.5))
+
+        # The history is cleared by a reset.
+        fdm.reset_to_initial_conditions(0)
+        fdm['test/input'] = 1.0
+        fdm.run()
+        self.assertEqual(fdm['test/frames'], 0.0)
+        self.assertEqual(fdm['test/time'], 0.0)
+
+
+RunTest(TestDelay)
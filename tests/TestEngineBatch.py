@@ -0,0 +1,81 @@
+# TestEngineBatch.py
+#
+# Check that the engines of the same type loaded from the same file, which share
+# the results of their "pre" functions, give exactly the same results as
+# engines that are executed independently.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import shutil
+from JSBSim_utils import JSBSimTestCase, RunTest, CreateFDM, CopyAircraftDef
+
+properties = ('thrust-lbs', 'n1', 'n2', 'fuel-flow-rate-pps', 'tsfc')
+
+
+class TestEngineBatch(JSBSimTestCase):
+    def start(self, engine_files):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts',
+                                                       '737_cruise.xml')
+        tree, aircraft_name, _ = CopyAircraftDef(script_path, self.sandbox)
+        engines = tree.getroot().findall('propulsion/engine')
+        for engine, name in zip(engines, engine_files):
+            engine.attrib['file'] = name
+            shutil.copy(self.sandbox.path_to_jsbsim_file('engine',
+                                                         'CFM56.xml'),
+                        name+'.xml')
+        tree.write(self.sandbox('aircraft', aircraft_name,
+                                aircraft_name+'.xml'))
+        shutil.copy(self.sandbox.path_to_jsbsim_file('engine', 'direct.xml'),
+                    '.')
+
+        fdm = CreateFDM(self.sandbox)
+        fdm.set_aircraft_path('aircraft')
+        fdm.set_engine_path('.')
+        fdm.load_script(script_path)
+        fdm.run_ic()
+        return fdm
+
+    def test_same_results(self):
+        # Both engines are loaded from the same file: they share their
+        # functions.
+        shared = self.start(('CFM56', 'CFM56'))
+        # The engines are loaded from different files: each engine evaluates
+        # its own functions.
+        single = self.start(('CFM56', 'CFM56_copy'))
+
+        for fdm in (shared, single):
+            fdm['propulsion/engine[0]/set-running'] = 1
+            fdm['propulsion/engine[1]/set-running'] = 1
+
+        for frame in range(3000):
+            # Different throttle settings so that the engines do not run in
+            # the same state.
+            for fdm in (shared, single):
+                fdm['fcs/throttle-cmd-norm[0]'] = 0.6
+                fdm['fcs/throttle-cmd-norm[1]'] = 0.6 + 0.4*(frame > 1000)
+                fdm.run()
+
+            for i in range(2):
+                for prop in properties:
+                    name = 'propulsion/engine[{}]/{}'.format(i, prop)
+                    self.assertEqual(shared[name], single[name], msg=name)
+
+            self.assertEqual(shared['position/h-sl-ft'],
+                             single['position/h-sl-ft'])
+
+
+RunTest(TestEngineBatch)
@@ -0,0 +1,123 @@
+# TestFCSBanks.py
+#
+# Check that the banks of actuators and filters built by FGFCSPipeline give
+# exactly the same results as the components executed by their Run() method.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import math
+import xml.etree.ElementTree as et
+from JSBSim_utils import JSBSimTestCase, RunTest, FlightModel
+
+num_surfaces = 32
+
+
+def add(parent, tag, text=None, **attrib):
+    element = et.SubElement(parent, tag, attrib)
+    if text is not None:
+        element.text = str(text)
+    return element
+
+
+def add_channel(system, name, constant):
+    # The parameters are given by properties when constant is False, so that
+    # the components cannot be compiled and are executed by their Run()
+    # method.
+    def parameter(prop, value):
+        return value if constant else prop
+
+    channel = add(system, 'channel', name=name)
+    for i in range(num_surfaces):
+        act = add(channel, 'actuator', name='test/{}/act-{}'.format(name, i))
+        add(act, 'input', 'test/cmd-{}'.format(i))
+        add(act, 'lag', parameter('test/lag-{}'.format(i), 20.0+i))
+        add(act, 'rate_limit', parameter('test/rate-{}'.format(i), 1.0+0.1*i))
+        add(act, 'deadband_width', 0.01)
+        add(act, 'hysteresis_width', 0.02)
+        add(act, 'bias', 0.001*i)
+        clip = add(act, 'clipto')
+        add(clip, 'min', -0.35)
+        add(clip, 'max', 0.35)
+    for i in range(num_surfaces):
+        lag = add(channel, 'lag_filter', name='test/{}/lag-{}'.format(name, i))
+        add(lag, 'input', 'test/{}/act-{}'.format(name, i))
+        add(lag, 'c1', parameter('test/c1-{}'.format(i), 5.0+i))
+    for i in range(num_surfaces):
+        order2 = add(channel, 'second_order_filter',
+                     name='test/{}/order2-{}'.format(name, i))
+        add(order2, 'input', 'test/{}/lag-{}'.format(name, i))
+        add(order2, 'c1', 1.0)
+        add(order2, 'c2', 0.0)
+        add(order2, 'c3', parameter('test/c3-{}'.format(i), 100.0+i))
+        add(order2, 'c4', 1.0)
+        add(order2, 'c5', 10.0)
+        add(order2, 'c6', 100.0)
+
+
+class TestFCSBanks(JSBSimTestCase):
+    def start(self, *channels):
+        tripod = FlightModel(self, 'tripod')
+        system = add(tripod.root, 'system', name='fcs banks')
+        for i in range(num_surfaces):
+            add(system, 'property', 'test/cmd-{}'.format(i))
+            add(system, 'property', 'test/lag-{}'.format(i),
+                value=str(20.0+i))
+            add(system, 'property', 'test/rate-{}'.format(i),
+                value=str(1.0+0.1*i))
+            add(system, 'property', 'test/c1-{}'.format(i), value=str(5.0+i))
+            add(system, 'property', 'test/c3-{}'.format(i),
+                value=str(100.0+i))
+        for name, constant in channels:
+            add_channel(system, name, constant)
+        return tripod.start()
+
+    def step(self, fdm, frame):
+        for i in range(num_surfaces):
+            fdm['test/cmd-{}'.format(i)] = 0.5*math.sin(0.01*frame*(i+1))
+        fdm.run()
+
+    def test_same_results(self):
+        fdm = self.start(('banked', True), ('run', False))
+        outputs = []
+        for i in range(num_surfaces):
+            for comp in ('act', 'lag', 'order2'):
+                outputs.append('{}-{}'.format(comp, i))
+            outputs.append('act-{}/saturated'.format(i))
+
+        def run_and_check(frames):
+            history = []
+            for frame in range(frames):
+                # Exercise the failures of the actuators.
+                for i, fail in enumerate(('fail_zero', 'fail_hardover',
+                                          'fail_stuck')):
+                    active = 200 <= frame < 300
+                    for name in ('banked', 'run'):
+                        fdm['test/{}/act-{}/malfunction/{}'.format(name, i,
+                                                                   fail)] = active
+                self.step(fdm, frame)
+                for name in outputs:
+                    self.assertEqual(fdm['test/banked/'+name],
+                                     fdm['test/run/'+name], msg=name)
+                history.append(fdm['test/banked/order2-0'])
+            return history
+
+        history = run_and_check(500)
+        fdm.reset_to_initial_conditions(0)
+        self.assertEqual(run_and_check(500), history)
+
+
+RunTest(TestFCSBanks)
@@ -0,0 +1,80 @@
+# TestFCSOrder.py
+#
+# Check the execution order of the FCS components: the components are executed
+# in their declaration order unless the channel requests them to be sorted
+# according to their dependencies. Also check that the channels that are
+# skipped when their inputs do not change give the same results.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest, FlightModel
+
+
+class TestFCSOrder(JSBSimTestCase):
+    def start(self):
+        tripod = FlightModel(self, 'tripod')
+        tripod.include_system_test_file('fcs_order.xml')
+        return tripod.start()
+
+    def test_declaration_order(self):
+        fdm = self.start()
+        fdm['test/input'] = 1.0
+        fdm.run()
+        # The first component is computed after the second one reads it.
+        self.assertAlmostEqual(fdm['test/declaration/first'], 3.0)
+        self.assertAlmostEqual(fdm['test/declaration/second'], 0.0)
+        fdm.run()
+        self.assertAlmostEqual(fdm['test/declaration/second'], 6.0)
+
+    def test_dependencies_order(self):
+        fdm = self.start()
+        fdm['test/input'] = 1.0
+        fdm.run()
+        # The components after the switch are sorted: 'third' is computed
+        # after 'fourth'.
+        self.assertAlmostEqual(fdm['test/dependencies/fourth'], -1.0)
+        self.assertAlmostEqual(fdm['test/dependencies/third'], -1.0)
+        # The switch is not moved so 'second', which is declared before it,
+        # still reads the value of 'first' from the previous frame.
+        self.assertAlmostEqual(fdm['test/dependencies/second'], 0.0)
+        fdm.run()
+        self.assertAlmostEqual(fdm['test/dependencies/second'], 6.0)
+        self.assertAlmostEqual(fdm['test/dependencies/third'], 5.0)
+
+    def test_skipped_channel(self):
+        fdm = self.start()
+        fdm['test/input'] = 1.0
+        fdm.run()
+        self.assertAlmostEqual(fdm['test/stateless/gain'], 0.5)
+
+        # An output modified by an other model is restored.
+        fdm['test/stateless/gain'] = 100.0
+        fdm.run()
+        self.assertAlmostEqual(fdm['test/stateless/gain'], 0.5)
+
+        # The channel is executed when an input changes.
+        fdm['test/other'] = 3.0
+        fdm.run()
+        self.assertAlmostEqual(fdm['test/stateless/sum'], 4.0)
+        self.assertAlmostEqual(fdm['test/stateless/gain'], 2.0)
+
+        for i in range(10):
+            fdm.run()
+            self.assertAlmostEqual(fdm['test/stateless/gain'], 2.0)
+
+
+RunTest(TestFCSOrder)
@@ -0,0 +1,65 @@
+# TestFCSPipeline.py
+#
+# Check that the compiled FCS components (see FGFCSPipeline) give exactly the
+# same results as the components executed by their Run() method.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import math
+from JSBSim_utils import JSBSimTestCase, RunTest, FlightModel
+
+components = ('sum', 'gain', 'deadband', 'lag', 'lag-output', 'order2')
+
+
+class TestFCSPipeline(JSBSimTestCase):
+    def start(self):
+        tripod = FlightModel(self, 'tripod')
+        tripod.include_system_test_file('fcs_pipeline.xml')
+        return tripod.start()
+
+    def run_and_check(self, fdm, frames):
+        history = []
+        for i in range(frames):
+            fdm['test/input'] = math.sin(0.05*i)
+            fdm['test/other'] = 0.3*math.cos(0.02*i)
+            fdm.run()
+            for name in components:
+                self.assertEqual(fdm['test/compiled/'+name],
+                                 fdm['test/run/'+name], msg=name)
+            history.append(fdm['test/compiled/order2'])
+        return history
+
+    def test_same_results(self):
+        fdm = self.start()
+        history = self.run_and_check(fdm, 500)
+
+        # The past states of the compiled filters are reset.
+        fdm.reset_to_initial_conditions(0)
+        self.assertEqual(self.run_and_check(fdm, 500), history)
+
+    def test_property_visibility(self):
+        fdm = self.start()
+        fdm['test/input'] = 1.0
+        fdm['test/other'] = 0.0
+        fdm.run()
+        self.assertAlmostEqual(fdm['test/compiled/sum'], 1.1)
+        # The gain reads the sum from the pipeline and is clipped.
+        self.assertAlmostEqual(fdm['test/compiled/gain'], 1.5)
+        self.assertAlmostEqual(fdm['test/compiled/deadband'], 1.4)
+
+
+RunTest(TestFCSPipeline)
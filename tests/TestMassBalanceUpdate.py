@@ -0,0 +1,80 @@
+# TestMassBalanceUpdate.py
+#
+# Check that the inertia matrix updated only when its inputs are modified gives
+# exactly the same results as the matrix recomputed at each time step and
+# count the number of updates.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest, CreateFDM
+
+properties = ('inertia/ixx-slugs_ft2', 'inertia/iyy-slugs_ft2',
+              'inertia/izz-slugs_ft2', 'inertia/ixz-slugs_ft2',
+              'inertia/cg-x-in', 'inertia/weight-lbs', 'position/h-sl-ft',
+              'attitude/theta-rad')
+
+
+class TestMassBalanceUpdate(JSBSimTestCase):
+    def start(self, script, threshold):
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts', script))
+        fdm.run_ic()
+        fdm['inertia/update-threshold'] = threshold
+        return fdm
+
+    def test_same_results(self):
+        # The C172 does not burn fuel in this script so the inertia matrix is
+        # only updated when a point mass is modified.
+        fdm = self.start('c1721.xml', 0.0)
+        ref = self.start('c1721.xml', -1.0)
+        count0 = fdm['inertia/update-count']
+
+        frame = 0
+        while fdm.run() and ref.run():
+            frame += 1
+            if frame == 300:
+                for f in (fdm, ref):
+                    f['inertia/pointmass-weight-lbs[1]'] = 180.0
+                    f['inertia/pointmass-location-X-inches[1]'] = 45.0
+            for prop in properties:
+                self.assertEqual(fdm[prop], ref[prop], msg=prop)
+
+        # The point mass modifies the CG hence the inertia of the tanks about
+        # the CG which is updated at the next time step.
+        self.assertGreaterEqual(ref['inertia/update-count'], frame)
+        self.assertGreater(fdm['inertia/update-count'], count0)
+        self.assertLessEqual(fdm['inertia/update-count'], count0+2)
+
+    def test_threshold(self):
+        # The 737 burns fuel so its inertia varies at each time step.
+        fdm = self.start('737_cruise.xml', 1E-4)
+        ref = self.start('737_cruise.xml', 0.0)
+        count0 = fdm['inertia/update-count']
+
+        for frame in range(6000):
+            fdm.run()
+            ref.run()
+
+        self.assertGreaterEqual(ref['inertia/update-count'], 6000)
+        self.assertLess(fdm['inertia/update-count'] - count0, 100)
+        for prop in ('inertia/ixx-slugs_ft2', 'inertia/iyy-slugs_ft2',
+                     'inertia/izz-slugs_ft2'):
+            self.assertAlmostEqual(fdm[prop]/ref[prop], 1.0, delta=1E-3,
+                                   msg=prop)
+
+
+RunTest(TestMassBalanceUpdate)
@@ -0,0 +1,67 @@
+# TestModelImage.py
+#
+# Check that the binary images of the aircraft give the same results as the XML
+# files.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import os, shutil
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestModelImage(JSBSimTestCase):
+    def copy_aircraft(self, name):
+        shutil.copytree(self.sandbox.path_to_jsbsim_file('aircraft', name),
+                        self.sandbox('aircraft', name))
+
+    def run_c172x(self):
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        self.assertTrue(fdm.load_model('c172x'))
+        fdm['ic/h-sl-ft'] = 1000.
+        fdm['ic/vc-kts'] = 100.
+        fdm['fcs/throttle-cmd-norm'] = 0.5
+        fdm.run_ic()
+        for i in range(1000):
+            fdm.run()
+        return fdm
+
+    def test_image(self):
+        self.copy_aircraft('c172x')
+        fdm = self.run_c172x()
+        ref = {p: fdm[p] for p in ('position/h-sl-ft', 'velocities/vc-kts',
+                                   'attitude/theta-deg', 'inertia/weight-lbs')}
+
+        # The image only contains the files of the model.
+        other = self.create_fdm()
+        other.load_model('ball')
+        self.assertTrue(fdm.write_model_image())
+        image = self.sandbox('aircraft', 'c172x', 'c172x.jsbimg')
+        self.assertTrue(os.path.exists(image))
+        with open(image, 'rb') as f:
+            content = f.read()
+        self.assertIn(b'c172x.xml', content)
+        self.assertNotIn(b'ball.xml', content)
+        self.assertNotIn(os.path.realpath(self.sandbox()).encode(), content)
+        self.delete_fdm()
+
+        fdm = self.run_c172x()
+        for p, value in ref.items():
+            self.assertEqual(fdm[p], value)
+
+
+RunTest(TestModelImage)
@@ -0,0 +1,59 @@
+# TestProfiler.py
+#
+# Test the profiling of the models, the FCS channels and the functions.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestProfiler(JSBSimTestCase):
+    def test_profile_properties(self):
+        fdm = self.create_fdm()
+        fdm['simulation/scheduler/systems/substeps'] = 4
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1721.xml'))
+        fdm.run_ic()
+
+        self.assertEqual(fdm['simulation/profile/enabled'], 0)
+        fdm['simulation/profile/enabled'] = 1
+        self.assertEqual(fdm['simulation/profile/enabled'], 1)
+
+        for i in range(100):
+            fdm.run()
+
+        # Sub-stepped models are counted once per frame.
+        for model in ('propagate', 'aerodynamics', 'systems'):
+            prop = 'simulation/profile/models/'+model
+            self.assertEqual(fdm[prop+'/calls'], 100)
+            self.assertGreater(fdm[prop+'/total-sec'], 0.0)
+            self.assertLessEqual(fdm[prop+'/mean-us'], fdm[prop+'/max-us'])
+
+        # The characters that are illegal in a property name are replaced by
+        # '_'. The channels are counted at each sub-step.
+        prop = 'simulation/profile/channels/FCS__c172/Pitch/calls'
+        self.assertEqual(fdm[prop], 400)
+        prop = 'simulation/profile/functions/aero/coefficient/CLwbh/calls'
+        self.assertEqual(fdm[prop], 100)
+
+        # Disabling the profiler freezes the statistics.
+        fdm['simulation/profile/enabled'] = 0
+        fdm.run()
+        self.assertEqual(fdm['simulation/profile/models/propagate/calls'], 100)
+
+
+RunTest(TestProfiler)
@@ -0,0 +1,93 @@
+# TestPropagateIntegrators.py
+#
+# Check the selection of the integration schemes of FGPropagate.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+integrands = ('simulation/integrator/position/rotational',
+              'simulation/integrator/rate/rotational',
+              'simulation/integrator/position/translational',
+              'simulation/integrator/rate/translational')
+# eIntegrateType values
+schemes = {'none': 0, 'rect euler': 1, 'trapezoidal': 2, 'AB2': 3, 'AB3': 4,
+           'AB4': 5, 'Buss1': 6, 'Buss2': 7, 'local linearization': 8,
+           'AB5': 9}
+# Schemes that can only integrate the rotational position.
+attitude_only = (6, 7, 8)
+state = ('position/lat-geod-rad', 'position/long-gc-rad', 'position/h-sl-ft',
+         'attitude/phi-rad', 'attitude/theta-rad', 'velocities/p-rad_sec',
+         'velocities/u-fps')
+
+
+class TestPropagateIntegrators(JSBSimTestCase):
+    def start(self, scheme):
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1723.xml'))
+        fdm.run_ic()
+        for integrand in integrands:
+            if scheme not in attitude_only or integrand == integrands[0]:
+                fdm[integrand] = scheme
+        return fdm
+
+    def run_frames(self, fdm, frames):
+        for frame in range(frames):
+            fdm.run()
+        return [fdm[name] for name in state]
+
+    def test_selection(self):
+        fdm = self.start(schemes['AB2'])
+        for integrand in integrands:
+            self.assertEqual(fdm[integrand], schemes['AB2'])
+        fdm['simulation/integrator/rate/translational'] = schemes['AB4']
+        self.assertEqual(fdm['simulation/integrator/rate/translational'],
+                         schemes['AB4'])
+        self.assertEqual(fdm['simulation/integrator/rate/rotational'],
+                         schemes['AB2'])
+
+        # The initial conditions restore the default schemes.
+        fdm.reset_to_initial_conditions(0)
+        self.assertEqual(fdm['simulation/integrator/position/rotational'], 1)
+        self.assertEqual(fdm['simulation/integrator/rate/rotational'], 1)
+        self.assertEqual(fdm['simulation/integrator/position/translational'], 4)
+        self.assertEqual(fdm['simulation/integrator/rate/translational'], 3)
+
+    def test_unknown_scheme(self):
+        # Unknown values freeze the state like eNone.
+        frozen = self.run_frames(self.start(schemes['none']), 500)
+        self.delete_fdm()
+        unknown = self.run_frames(self.start(42), 500)
+        self.assertEqual(frozen, unknown)
+
+    def test_schemes(self):
+        # All the schemes give close results over a short run.
+        results = {}
+        for name, scheme in schemes.items():
+            if scheme == 0:
+                continue
+            results[name] = self.run_frames(self.start(scheme), 2000)
+            self.delete_fdm()
+
+        ref = results['rect euler']
+        for name, values in results.items():
+            self.assertAlmostEqual(values[2], ref[2], delta=1.0, msg=name)
+            self.assertAlmostEqual(values[3], ref[3], delta=0.05, msg=name)
+
+
+RunTest(TestPropagateIntegrators)
@@ -0,0 +1,74 @@
+# TestPropellerGrid.py
+#
+# Check that the coefficients of a propeller looked up in the precomputed grid
+# give the same results as the tables.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import shutil
+import xml.etree.ElementTree as et
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+properties = ('thrust-lbs', 'thrust-coefficient', 'propeller-power-ftlbps',
+              'blade-angle', 'helical-tip-Mach')
+
+
+class TestPropellerGrid(JSBSimTestCase):
+    def start(self, precompute):
+        # The deHavilland propeller is variable pitch and has CT_MACH and
+        # CP_MACH tables.
+        tree = et.parse(self.sandbox.path_to_jsbsim_file(
+            'engine', 'prop_deHavilland5000.xml'))
+        et.SubElement(tree.getroot(), 'precompute').text = str(precompute)
+        tree.write('prop_deHavilland5000.xml')
+        shutil.copy(self.sandbox.path_to_jsbsim_file('engine',
+                                                     'eng_PegasusXc.xml'),
+                    '.')
+
+        fdm = self.create_fdm()
+        fdm.set_engine_path('.')
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'Short_S23_1.xml'))
+        fdm.run_ic()
+        return fdm
+
+    def test_same_results(self):
+        tables = self.start(0)
+        grid = self.start(1)
+
+        for frame in range(6000):
+            tables.run()
+            grid.run()
+            for i in range(4):
+                for prop in properties:
+                    name = 'propulsion/engine[{}]/{}'.format(i, prop)
+                    tol = 1E-8*max(abs(tables[name]), 1.0)
+                    self.assertAlmostEqual(grid[name], tables[name], delta=tol,
+                                           msg=name)
+
+        # The final thrust of each engine looked up in the grid matches the
+        # direct evaluation of the tables.
+        for i in range(4):
+            name = 'propulsion/engine[{}]/thrust-lbs'.format(i)
+            self.assertAlmostEqual(grid[name], tables[name],
+                                   delta=1E-8*max(abs(tables[name]), 1.0),
+                                   msg=name)
+        self.assertAlmostEqual(grid['position/h-sl-ft'],
+                               tables['position/h-sl-ft'], delta=1E-6)
+
+
+RunTest(TestPropellerGrid)
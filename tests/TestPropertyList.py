@@ -0,0 +1,104 @@
+# TestPropertyList.py
+#
+# Check that the values of a list of properties are read and written in bulk
+# by FGPropertyList.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import numpy as np
+from JSBSim_utils import JSBSimTestCase, RunTest, jsbsim
+
+observations = ('position/h-sl-ft', 'position/lat-geod-deg',
+                'position/long-gc-deg', 'velocities/u-fps', 'velocities/v-fps',
+                'velocities/w-fps', 'velocities/p-rad_sec',
+                'velocities/q-rad_sec', 'velocities/r-rad_sec',
+                'attitude/phi-rad', 'attitude/theta-rad', 'attitude/psi-rad',
+                'aero/alpha-rad', 'aero/beta-rad', 'velocities/vc-kts',
+                'fcs/elevator-pos-rad', 'fcs/left-aileron-pos-rad',
+                'fcs/rudder-pos-rad', 'propulsion/engine/thrust-lbs',
+                'simulation/sim-time-sec')
+actions = ('fcs/aileron-cmd-norm', 'fcs/elevator-cmd-norm',
+           'fcs/rudder-cmd-norm', 'fcs/throttle-cmd-norm')
+
+
+class TestPropertyList(JSBSimTestCase):
+    def start(self):
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1723.xml'))
+        fdm.run_ic()
+        return fdm
+
+    def test_get_set(self):
+        fdm = self.start()
+        obs = fdm.get_property_list(observations)
+        self.assertEqual(len(obs), len(observations))
+        self.assertEqual(obs.get_names(), observations)
+
+        for frame in range(10):
+            fdm.run()
+            values = obs.get_values()
+            self.assertEqual(values.shape, (len(observations),))
+            for name, value in zip(observations, values):
+                self.assertEqual(fdm[name], value, msg=name)
+
+        # Preallocated buffer
+        buffer = np.zeros(len(observations))
+        self.assertIs(obs.get_values(buffer), buffer)
+        np.testing.assert_array_equal(buffer, values)
+        with self.assertRaises(ValueError):
+            obs.get_values(np.zeros(3))
+
+        act = jsbsim.FGPropertyList(fdm, actions)
+        act.set_values([0.1, -0.2, 0.3, 0.4])
+        for name, value in zip(actions, [0.1, -0.2, 0.3, 0.4]):
+            self.assertEqual(fdm[name], value, msg=name)
+        act.set_values(np.array([0.0, 0.0, 0.0, 1.0]))
+        self.assertEqual(fdm['fcs/aileron-cmd-norm'], 0.0)
+        self.assertEqual(fdm['fcs/throttle-cmd-norm'], 1.0)
+        with self.assertRaises(ValueError):
+            act.set_values([0.0])
+
+        # Missing properties
+        with self.assertRaises(jsbsim.JSBBaseError):
+            fdm.get_property_list(['test/does-not-exist'])
+        new = fdm.get_property_list(['test/a', 'test/b'], create=True)
+        new.set_values([1.0, 2.0])
+        self.assertEqual(fdm['test/a'], 1.0)
+        self.assertEqual(fdm['test/b'], 2.0)
+
+    def test_simulation_loop(self):
+        # Bulk accesses in a control loop give the same values as the accesses
+        # to the properties one by one.
+        fdm = self.start()
+        obs_names = observations * 3
+        obs = fdm.get_property_list(obs_names)
+        act = fdm.get_property_list(actions)
+        buffer = np.empty(len(obs_names))
+
+        for step in range(200):
+            command = [0.1*np.sin(0.01*step), -0.05, 0.0, 1.0]
+            act.set_values(command)
+            fdm.run()
+            obs.get_values(buffer)
+            np.testing.assert_array_equal(
+                buffer, np.array([fdm[name] for name in obs_names]))
+            for name, value in zip(actions, command):
+                self.assertEqual(fdm[name], value, msg=name)
+
+
+RunTest(TestPropertyList)
@@ -0,0 +1,92 @@
+# TestRotorBladeElement.py
+#
+# Check the blade-element model of FGRotor against the closed form model of
+# /SH79/ on the AH-1S.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import math, shutil
+import xml.etree.ElementTree as et
+from JSBSim_utils import JSBSimTestCase, RunTest, ExecuteUntil
+
+rotors = ('propulsion/engine[0]', 'propulsion/engine[1]')
+
+
+class TestRotorBladeElement(JSBSimTestCase):
+    def start(self):
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'ah1s_flight_test.xml'))
+        fdm.run_ic()
+        # The rotor is spun up and the helicopter hovers after 60 seconds.
+        ExecuteUntil(fdm, 60.0)
+        return fdm
+
+    def set_mode(self, fdm, mode):
+        for rotor in rotors:
+            fdm[rotor+'/blade-element-mode'] = mode
+
+    def test_consistency(self):
+        fdm = self.start()
+        for rotor in rotors:
+            self.assertEqual(fdm[rotor+'/blade-element-mode'], 0.0)
+
+        # Both models give close loads for the same state: within 3% for the
+        # main rotor and 8% for the tail rotor.
+        fdm.run()
+        thrust = [fdm[rotor+'/thrust-lbs'] for rotor in rotors]
+        torque = [fdm[rotor+'/torque-lbsft'] for rotor in rotors]
+        self.set_mode(fdm, 1)
+        fdm.run()
+        for i, tol in enumerate((0.03, 0.08)):
+            rotor = rotors[i]
+            self.assertAlmostEqual(fdm[rotor+'/thrust-lbs']/thrust[i], 1.0,
+                                   delta=tol)
+            self.assertAlmostEqual(fdm[rotor+'/torque-lbsft']/torque[i], 1.0,
+                                   delta=tol)
+
+        # The blade-element model flies the script: hover then acceleration.
+        ExecuteUntil(fdm, 200.0)
+        self.assertGreater(fdm['position/h-agl-ft'], 50.0)
+        self.assertGreater(fdm['velocities/u-aero-fps'], 80.0)
+        self.assertAlmostEqual(fdm[rotors[0]+'/rotor-rpm'], 324.0, delta=5.0)
+        self.assertFalse(math.isnan(fdm[rotors[0]+'/a1-rad']))
+
+    def test_configuration(self):
+        # The blade-element model is selected by the <bladeelement> element.
+        tree = et.parse(self.sandbox.path_to_jsbsim_file('engine',
+                                                         'ah1s_rotor.xml'))
+        be = et.SubElement(tree.getroot(), 'bladeelement')
+        et.SubElement(be, 'stations').text = '10'
+        et.SubElement(be, 'azimuths').text = '36'
+        tree.write('ah1s_rotor.xml')
+        shutil.copy(self.sandbox.path_to_jsbsim_file('engine',
+                                                     'ah1s_tail_rotor.xml'),
+                    '.')
+
+        fdm = self.create_fdm()
+        fdm.set_engine_path('.')
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'ah1s_flight_test.xml'))
+        fdm.run_ic()
+        self.assertEqual(fdm[rotors[0]+'/blade-element-mode'], 1.0)
+        self.assertEqual(fdm[rotors[1]+'/blade-element-mode'], 0.0)
+        ExecuteUntil(fdm, 60.0)
+        self.assertGreater(fdm['position/h-agl-ft'], 20.0)
+
+
+RunTest(TestRotorBladeElement)
@@ -0,0 +1,104 @@
+# TestRunUntil.py
+#
+# Check that FGFDMExec::RunUntil() and FGFDMExec::RunFrames() give the same
+# results as calling FGFDMExec::Run() in a loop.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+properties = ('position/h-sl-ft', 'position/lat-geod-deg',
+              'velocities/u-fps', 'attitude/theta-rad')
+
+
+class TestRunUntil(JSBSimTestCase):
+    def start(self, dt=0.0):
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1723.xml'), dt)
+        fdm.run_ic()
+        return fdm
+
+    def test_same_results(self):
+        fdm = self.start()
+        dt = fdm.get_delta_t()
+        while fdm.get_sim_time() < 20.0 - 0.5*dt:
+            fdm.run()
+        for frame in range(100):
+            fdm.run()
+        ref = [fdm[prop] for prop in properties]
+        ref_time = fdm.get_sim_time()
+        self.delete_fdm()
+
+        fdm = self.start()
+        self.assertTrue(fdm.run_until(20.0))
+        self.assertAlmostEqual(fdm.get_sim_time(), 20.0, delta=0.5*dt)
+        self.assertTrue(fdm.run_frames(100))
+        self.assertEqual(fdm.get_sim_time(), ref_time)
+        for prop, value in zip(properties, ref):
+            self.assertEqual(fdm[prop], value, msg=prop)
+
+    def test_stop_condition(self):
+        fdm = self.start()
+        self.assertTrue(fdm.run_until(1000.0, 'position/h-agl-ft gt 1000\n'
+                                              'velocities/vc-kts gt 10'))
+        self.assertLess(fdm.get_sim_time(), 1000.0)
+        self.assertGreater(fdm['position/h-agl-ft'], 1000.0)
+
+        # The condition is evaluated after each frame.
+        t = fdm.get_sim_time()
+        fdm.run_frames(10, 'simulation/sim-time-sec gt 0')
+        self.assertAlmostEqual(fdm.get_sim_time() - t, fdm.get_delta_t(),
+                               delta=1E-9)
+
+        # Time does not progress while holding.
+        t = fdm.get_sim_time()
+        fdm.hold()
+        self.assertTrue(fdm.run_until(t + 10.0))
+        self.assertEqual(fdm.get_sim_time(), t)
+        fdm.resume()
+
+        # The end of the script stops the execution.
+        self.assertFalse(fdm.run_until(1E9))
+        self.assertLess(fdm.get_sim_time(), 1E9)
+
+    def test_frame_count(self):
+        fdm = self.start(0.001)
+        dt = fdm.get_delta_t()
+        # The rounding errors accumulated in the simulation time must not
+        # trigger an extra frame.
+        for frames in (1, 10, 1000):
+            t = fdm.get_sim_time()
+            self.assertTrue(fdm.run_until(t + frames*dt))
+            self.assertAlmostEqual(fdm.get_sim_time() - t, frames*dt,
+                                   delta=0.5*dt)
+
+        # The frames executed by run_frames() and run_until() are the same as
+        # with a loop of run().
+        state = [fdm[prop] for prop in properties]
+        t = fdm.get_sim_time()
+        self.delete_fdm()
+
+        fdm = self.start(0.001)
+        while fdm.get_sim_time() < t - 0.5*dt:
+            fdm.run()
+        self.assertEqual(fdm.get_sim_time(), t)
+        for prop, value in zip(properties, state):
+            self.assertEqual(fdm[prop], value, msg=prop)
+
+
+RunTest(TestRunUntil)
@@ -0,0 +1,65 @@
+# TestScheduler.py
+#
+# Test the multirate scheduling of the models and of the FCS channels.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest, FlightModel
+
+
+class TestScheduler(JSBSimTestCase):
+    def test_channel_substeps(self):
+        tripod = FlightModel(self, 'tripod')
+        tripod.include_system_test_file('substeps.xml')
+        fdm = tripod.start()
+
+        dt = fdm['simulation/dt']
+
+        for i in range(10):
+            counter = fdm['test/counter']
+            fdm.run()
+            self.assertEqual(fdm['test/counter'], counter+4)
+            self.assertAlmostEqual(fdm['test/channel-dt'], dt/4)
+
+    def test_model_schedule(self):
+        fdm = self.create_fdm()
+        fdm['simulation/scheduler/aerodynamics/rate'] = 2
+        fdm['simulation/scheduler/systems/substeps'] = 2
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1721.xml'))
+        fdm.run_ic()
+
+        self.assertEqual(fdm['simulation/scheduler/aerodynamics/rate'], 2)
+        self.assertEqual(fdm['simulation/scheduler/systems/substeps'], 2)
+
+        # Only the flight control systems integrate with the sub-step time
+        # step.
+        for model in ('propagate', 'accelerations', 'ground_reactions',
+                      'propulsion', 'aerodynamics'):
+            prop = 'simulation/scheduler/{}/substeps'.format(model)
+            fdm[prop] = 4
+            self.assertEqual(fdm[prop], 1, msg=prop)
+
+        # The FCS schedule can not be modified once the aircraft is loaded.
+        fdm['simulation/scheduler/systems/substeps'] = 1
+        self.assertEqual(fdm['simulation/scheduler/systems/substeps'], 2)
+
+        while fdm.run():
+            pass
+
+
+RunTest(TestScheduler)
@@ -0,0 +1,134 @@
+# TestScriptEvents.py
+#
+# Check that the script events are executed in the order of the script when
+# they are scheduled by time or woken up by the modification of a property.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import xml.etree.ElementTree as et
+from JSBSim_utils import JSBSimTestCase, RunTest, ExecuteUntil
+
+
+class TestScriptEvents(JSBSimTestCase):
+    def create_script(self, name, end_time):
+        tree = et.parse(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1722.xml'))
+        run = tree.getroot().find('run')
+        run.attrib['end'] = str(end_time)
+        for event in run.findall('event'):
+            run.remove(event)
+        for prop in ('a', 'b', 'c', 'count', 'toggle'):
+            local = et.SubElement(run, 'property')
+            local.attrib['value'] = '0'
+            local.text = 'test/'+prop
+        self.script = name
+        self.tree = tree
+        return run
+
+    def add_event(self, run, name, condition, sets, persistent=False):
+        event = et.SubElement(run, 'event')
+        event.attrib['name'] = name
+        if persistent:
+            event.attrib['persistent'] = 'true'
+        et.SubElement(event, 'condition').text = condition
+        for attrib in sets:
+            et.SubElement(event, 'set').attrib.update(attrib)
+
+    def load(self):
+        self.tree.write(self.script)
+        fdm = self.create_fdm()
+        fdm.load_script(self.script)
+        fdm.run_ic()
+        return fdm
+
+    def test_event_order(self):
+        run = self.create_script('events.xml', 5.0)
+        # Reads a property that is modified by a later event.
+        self.add_event(run, 'late reader', 'test/a ge 2',
+                       [{'name': 'test/c', 'value': '1'}])
+        self.add_event(run, 'timed', 'simulation/sim-time-sec ge 0.5',
+                       [{'name': 'test/a', 'value': '1'}])
+        # Reads a property that is modified by an earlier event.
+        self.add_event(run, 'early reader', 'test/a ge 1',
+                       [{'name': 'test/a', 'value': '2'}])
+        self.add_event(run, 'watcher', 'test/toggle eq 1',
+                       [{'name': 'test/count', 'value': '1',
+                         'type': 'FG_DELTA'}], persistent=True)
+        self.add_event(run, 'ramp', 'simulation/sim-time-sec ge 1.0',
+                       [{'name': 'test/b', 'value': '5', 'action': 'FG_RAMP',
+                         'tc': '1.0'}])
+        fdm = self.load()
+
+        for i in range(2):
+            # The events that are woken up by an event are executed during the
+            # same time step if they come later in the script and at the next
+            # time step otherwise.
+            while fdm['test/a'] == 0.0:
+                fdm.run()
+            self.assertGreater(fdm.get_sim_time(), 0.5)
+            self.assertEqual(fdm['test/a'], 2.0)
+            self.assertEqual(fdm['test/c'], 0.0)
+            fdm.run()
+            self.assertEqual(fdm['test/c'], 1.0)
+
+            # Persistent event woken up by the modification of a property.
+            self.assertEqual(fdm['test/count'], 0.0)
+            fdm['test/toggle'] = 1.0
+            for frame in range(10):
+                fdm.run()
+            self.assertEqual(fdm['test/count'], 1.0)
+            fdm['test/toggle'] = 0.0
+            fdm.run()
+            fdm['test/toggle'] = 1.0
+            fdm.run()
+            self.assertEqual(fdm['test/count'], 2.0)
+
+            ExecuteUntil(fdm, 1.5)
+            self.assertGreater(fdm['test/b'], 2.0)
+            self.assertLess(fdm['test/b'], 3.0)
+            ExecuteUntil(fdm, 2.5)
+            self.assertEqual(fdm['test/b'], 5.0)
+
+            # The events are scheduled again after a reset.
+            fdm.reset_to_initial_conditions(0)
+            self.assertEqual(fdm['test/a'], 0.0)
+
+    def test_many_events(self):
+        events = 2000
+        run = self.create_script('many_events.xml', 10.0)
+        for i in range(events):
+            self.add_event(run, 'event {}'.format(i),
+                           'simulation/sim-time-sec ge {}'.format(i*0.004),
+                           [{'name': 'test/count', 'value': '1',
+                             'type': 'FG_DELTA'}])
+        fdm = self.load()
+
+        # Each event is executed once, at the first time step that meets its
+        # condition.
+        while fdm.run():
+            t = fdm.get_sim_time()
+            if t >= events*0.004:
+                break
+            self.assertEqual(fdm['test/count'], int(t/0.004 + 1E-9) + 1,
+                             msg='t={}'.format(t))
+
+        while fdm.run():
+            pass
+        self.assertEqual(fdm['test/count'], events)
+
+
+RunTest(TestScriptEvents)
@@ -0,0 +1,197 @@
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+#include <math/FGCondition.h>
+#include <input_output/FGXMLParse.h>
+#include <input_output/FGPropertyManager.h>
+
+using namespace JSBSim;
+
+
+Element_ptr readFromXML(const std::string& XML) {
+  std::istringstream data(XML);
+  FGXMLParse parser;
+  readXML(data, parser);
+  return parser.GetDocument();
+}
+
+
+class FGConditionTest : public CxxTest::TestSuite
+{
+public:
+  std::shared_ptr<FGPropertyManager> pm;
+  FGPropertyNode_ptr a, b, c;
+
+  void setUp() {
+    pm = std::make_shared<FGPropertyManager>();
+    a = pm->GetNode("a", true);
+    b = pm->GetNode("b", true);
+    c = pm->GetNode("c", true);
+  }
+
+  void testComparisons() {
+    const char* ops[] = {"EQ", "NE", "GT", "GE", "LT", "LE"};
+    const double values[] = {-1.0, 0.0, 0.5, 1.0};
+
+    for (unsigned int op=0; op<6; op++) {
+      Element_ptr el = readFromXML(std::string("<test>a ")+ops[op]
+                                   +" 0.5</test>");
+      FGCondition cond(el, pm);
+      // The first evaluation walks the tree of conditions and the next ones
+      // execute the compiled program.
+      for (unsigned int pass=0; pass<2; pass++) {
+        for (double x: values) {
+          a->setDoubleValue(x);
+          bool expected[] = {x == 0.5, x != 0.5, x > 0.5, x >= 0.5, x < 0.5,
+                             x <= 0.5};
+          TS_ASSERT_EQUALS(cond.Evaluate(), expected[op]);
+        }
+      }
+    }
+  }
+
+  void testPropertyOperands() {
+    Element_ptr el = readFromXML("<test>-a lt -b</test>");
+    FGCondition cond(el, pm);
+
+    for (unsigned int pass=0; pass<2; pass++) {
+      a->setDoubleValue(1.0);
+      b->setDoubleValue(2.0);
+      TS_ASSERT(!cond.Evaluate());
+      a->setDoubleValue(3.0);
+      TS_ASSERT(cond.Evaluate());
+    }
+  }
+
+  void testGroups() {
+    Element_ptr el = readFromXML("<test logic=\"OR\">"
+                                 "  a GT 0.5\n"
+                                 "  <test logic=\"AND\">"
+                                 "    b EQ 1\n"
+                                 "    <test logic=\"OR\">"
+                                 "      c LT 0\n"
+                                 "      c GE a\n"
+                                 "    </test>"
+                                 "  </test>"
+                                 "  b EQ -1\n"
+                                 "</test>");
+    FGCondition cond(el, pm);
+    const double values[] = {-1.0, 0.0, 0.5, 1.0};
+
+    for (unsigned int pass=0; pass<2; pass++) {
+      for (double x: values) {
+        for (double y: values) {
+          for (double z: values) {
+            a->setDoubleValue(x);
+            b->setDoubleValue(y);
+            c->setDoubleValue(z);
+            bool expected = x > 0.5 || (y == 1.0 && (z < 0.0 || z >= x))
+                            || y == -1.0;
+            TS_ASSERT_EQUALS(cond.Evaluate(), expected);
+          }
+        }
+      }
+    }
+  }
+
+  void testEmptyGroup() {
+    // An empty group is not compiled.
+    Element_ptr el = readFromXML("<test logic=\"AND\">"
+                                 "  a GT 0.5\n"
+                                 "  <test logic=\"OR\"/>"
+                                 "</test>");
+    FGCondition cond(el, pm);
+
+    for (unsigned int pass=0; pass<2; pass++) {
+      a->setDoubleValue(1.0);
+      TS_ASSERT(!cond.Evaluate());
+    }
+  }
+
+  void testLateBound() {
+    Element_ptr el = readFromXML("<test logic=\"AND\">"
+                                 "  a GT 0.5\n"
+                                 "  x LT 0\n"
+                                 "</test>");
+    FGCondition cond(el, pm);
+
+    a->setDoubleValue(1.0);
+    TS_ASSERT_THROWS(cond.Evaluate(), std::string&);
+    FGPropertyNode_ptr x = pm->GetNode("x", true);
+    x->setDoubleValue(-1.0);
+    TS_ASSERT(cond.Evaluate());
+    TS_ASSERT(cond.Evaluate());
+    x->setDoubleValue(1.0);
+    TS_ASSERT(!cond.Evaluate());
+  }
+
+  // Switch-like conditions: an AND group of 3 tests where the last test is an
+  // OR group of 2 tests. The properties are read from a set of 50 properties.
+  void testRandomConditions() {
+    const unsigned int nConditions = 1000;
+    const unsigned int nProperties = 50;
+    const unsigned int nSamples = 100;
+    std::mt19937 gen(20261018);
+    std::uniform_int_distribution<unsigned int> index(0, nProperties-1);
+    std::uniform_real_distribution<double> value(-1.0, 1.0);
+    std::vector<FGPropertyNode_ptr> nodes;
+    std::vector<FGCondition*> conditions;
+    std::vector<std::vector<unsigned int> > operands;
+    std::vector<std::vector<double> > thresholds;
+
+    for (unsigned int i=0; i<nProperties; i++) {
+      std::ostringstream name;
+      name << "fcs/p" << i;
+      nodes.push_back(pm->GetNode(name.str(), true));
+    }
+
+    for (unsigned int i=0; i<nConditions; i++) {
+      std::vector<unsigned int> p(4);
+      std::vector<double> t(4);
+      std::ostringstream xml;
+      xml << std::setprecision(17);
+      for (unsigned int k=0; k<4; k++) {
+        p[k] = index(gen);
+        t[k] = value(gen);
+      }
+      xml << "<test logic=\"AND\">"
+          << "fcs/p" << p[0] << " GT " << t[0] << "\n"
+          << "fcs/p" << p[1] << " LE " << t[1] << "\n"
+          << "<test logic=\"OR\">"
+          << "fcs/p" << p[2] << " GE " << t[2] << "\n"
+          << "fcs/p" << p[3] << " LT " << t[3] << "\n"
+          << "</test></test>";
+      Element_ptr el = readFromXML(xml.str());
+      conditions.push_back(new FGCondition(el, pm));
+      operands.push_back(p);
+      thresholds.push_back(t);
+    }
+
+    unsigned int count = 0;
+
+    for (unsigned int sample=0; sample<nSamples; sample++) {
+      for (auto& node: nodes)
+        node->setDoubleValue(value(gen));
+
+      for (unsigned int i=0; i<nConditions; i++) {
+        const std::vector<unsigned int>& p = operands[i];
+        const std::vector<double>& t = thresholds[i];
+        bool expected = nodes[p[0]]->getDoubleValue() > t[0]
+          && nodes[p[1]]->getDoubleValue() <= t[1]
+          && (nodes[p[2]]->getDoubleValue() >= t[2]
+              || nodes[p[3]]->getDoubleValue() < t[3]);
+        TS_ASSERT_EQUALS(conditions[i]->Evaluate(), expected);
+        if (expected) ++count;
+      }
+    }
+
+    // Both outcomes have been checked.
+    TS_ASSERT_LESS_THAN(0U, count);
+    TS_ASSERT_LESS_THAN(count, nSamples*nConditions);
+
+    for (auto cond: conditions) delete cond;
+  }
+};
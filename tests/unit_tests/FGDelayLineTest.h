@@ -0,0 +1,61 @@
+#include <cxxtest/TestSuite.h>
+
+#include <math/FGDelayLine.h>
+
+using namespace JSBSim;
+
+class FGDelayLineTest : public CxxTest::TestSuite
+{
+public:
+  void testDefault() {
+    FGDelayLine line;
+    TS_ASSERT_EQUALS(line.GetDelay(), 0.0);
+    for (int i=0; i<5; ++i)
+      TS_ASSERT_EQUALS(line.Run(i), i);
+  }
+
+  void testIntegerDelay() {
+    FGDelayLine line;
+    line.SetDelay(1.0);
+    TS_ASSERT_EQUALS(line.Run(1.0), 1.0);
+    TS_ASSERT_EQUALS(line.Run(2.0), 2.0);
+
+    // A delay of n frames returns the sample received n-1 frames earlier.
+    line.SetDelay(4.0);
+    TS_ASSERT_EQUALS(line.GetDelay(), 4.0);
+    for (int i=0; i<20; ++i)
+      TS_ASSERT_EQUALS(line.Run(i+1.0), i < 3 ? 0.0 : i-2.0);
+  }
+
+  void testFractionalDelay() {
+    FGDelayLine line;
+    line.SetDelay(2.25);
+    TS_ASSERT_EQUALS(line.Run(1.0), 0.0);
+    TS_ASSERT_DELTA(line.Run(2.0), 0.75, 1E-12);
+    for (int i=2; i<20; ++i)
+      TS_ASSERT_DELTA(line.Run(i+1.0), i-0.25, 1E-12);
+  }
+
+  void testRounding() {
+    FGDelayLine line;
+    line.SetDelay(23.999999999999996);
+    TS_ASSERT_EQUALS(line.GetDelay(), 24.0);
+    line.SetDelay(-1.0);
+    TS_ASSERT_EQUALS(line.GetDelay(), 0.0);
+    TS_ASSERT_EQUALS(line.Run(3.0), 3.0);
+  }
+
+  void testFillAndReset() {
+    FGDelayLine line;
+    line.SetDelay(3.0);
+    line.Fill(5.0);
+    TS_ASSERT_EQUALS(line.Run(1.0), 5.0);
+    TS_ASSERT_EQUALS(line.Run(2.0), 5.0);
+    TS_ASSERT_EQUALS(line.Run(3.0), 1.0);
+
+    line.Reset();
+    TS_ASSERT_EQUALS(line.Run(4.0), 0.0);
+    TS_ASSERT_EQUALS(line.Run(5.0), 0.0);
+    TS_ASSERT_EQUALS(line.Run(6.0), 4.0);
+  }
+};
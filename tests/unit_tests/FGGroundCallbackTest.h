@@ -1,5 +1,6 @@
 #include <limits>
 #include <memory>
+#include <vector>
 #include <cxxtest/TestSuite.h>
 
 #include <FGFDMExec.h>
@@ -240,6 +241,83 @@ public:
     }
   }
 
+  void testBatchQuery() {
+    std::unique_ptr<FGGroundCallback> cb(new FGDefaultGroundCallback(a, b));
+    std::vector<FGLocation> locations;
+    std::vector<FGGroundCallback::ContactPoint> contacts;
+    FGLocation loc, contact;
+    FGColumnVector3 normal, v, w;
+
+    cb->SetTerrainElevation(2000.);
+    loc.SetEllipse(a, b);
+
+    for(double lat = -90.0; lat <= 90.; lat += 30.) {
+      for(double lon = 0.0; lon <=360.; lon += 45.){
+        loc.SetPositionGeodetic(lon*M_PI/180., lat*M_PI/180., 100000.+lat);
+        locations.push_back(loc);
+      }
+    }
+
+    cb->GetAGLevels(locations, contacts);
+    TS_ASSERT_EQUALS(contacts.size(), locations.size());
+
+    // The batch query must return the same results than the single queries.
+    for (unsigned int i=0; i<locations.size(); i++) {
+      double agl = cb->GetAGLevel(locations[i], contact, normal, v, w);
+      TS_ASSERT_EQUALS(contacts[i].agl, agl);
+      TS_ASSERT_VECTOR_EQUALS(FGColumnVector3(contacts[i].contact), FGColumnVector3(contact));
+      TS_ASSERT_VECTOR_EQUALS(contacts[i].normal, normal);
+      TS_ASSERT_VECTOR_EQUALS(contacts[i].velocity, v);
+      TS_ASSERT_VECTOR_EQUALS(contacts[i].ang_velocity, w);
+    }
+
+    // The output vector is resized to the number of locations.
+    locations.resize(3);
+    cb->GetAGLevels(locations, contacts);
+    TS_ASSERT_EQUALS(contacts.size(), 3);
+  }
+
+  void testClone() {
+    FGDefaultGroundCallback cb(a, b);
+    FGLocation loc, contact;
+    FGColumnVector3 normal, v, w;
+
+    cb.SetTerrainElevation(2000.);
+    std::unique_ptr<FGGroundCallback> copy(cb.Clone());
+    TS_ASSERT(copy);
+
+    loc.SetEllipse(a, b);
+    loc.SetPositionGeodetic(0.5, 0.7, 5000.);
+    TS_ASSERT_DELTA(copy->GetAGLevel(loc, contact, normal, v, w), 3000.,
+                    1E-8);
+
+    // The copy is independent from the original.
+    cb.SetTerrainElevation(0.);
+    TS_ASSERT_DELTA(copy->GetAGLevel(loc, contact, normal, v, w), 3000.,
+                    1E-8);
+
+    // Ground callbacks do not support copies by default.
+    DummyGroundCallback dummy(a, b);
+    TS_ASSERT(!dummy.Clone());
+  }
+
+  void testMaxTerrainElevation() {
+    FGDefaultGroundCallback cb(a, b);
+    FGLocation loc;
+    loc.SetEllipse(a, b);
+    loc.SetPositionGeodetic(0.5, 0.7, 5000.);
+    double hmax = 0.0;
+
+    cb.SetTerrainElevation(2000.);
+    TS_ASSERT(cb.GetMaxTerrainElevation(loc, 100., hmax));
+    TS_ASSERT_EQUALS(hmax, 2000.);
+
+    // The derived classes may model any terrain: their elevation is not
+    // bounded unless they override GetMaxTerrainElevation().
+    DummyGroundCallback dummy(a, b);
+    TS_ASSERT(!dummy.GetMaxTerrainElevation(loc, 100., hmax));
+  }
+
   // Regression test for FlightGear.
   //
   // Check that JSBSim does not crash (assertion "ellipse not set") when using
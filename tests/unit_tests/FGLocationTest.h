@@ -698,4 +698,42 @@ public:
       }
     }
   }
+
+  void testCachedDerivedValues()
+  {
+    const double a = 20925646.32546; // WGS84 semimajor axis length in feet
+    const double b = 20855486.5951;  // WGS84 semiminor axis length in feet
+    JSBSim::FGLocation l;
+    l.SetEllipse(a, b);
+    l.SetPositionGeodetic(0.1, 0.7, 1000.);
+
+    unsigned long count = l.GetNumComputeDerived();
+    double alt = l.GetGeodAltitude();
+    TS_ASSERT_EQUALS(l.GetNumComputeDerived(), count+1);
+    l.GetTl2ec();
+    TS_ASSERT_EQUALS(l.GetNumComputeDerived(), count+1);
+
+    // The copies share the derived values of the original and setting the
+    // same ellipse does not invalidate them.
+    JSBSim::FGLocation l2 = l;
+    l2.SetEllipse(a, b);
+    TS_ASSERT_EQUALS(l2.GetGeodAltitude(), alt);
+    TS_ASSERT_EQUALS(l.GetGeodLatitudeRad(), l2.GetGeodLatitudeRad());
+    TS_ASSERT_EQUALS(l2.GetNumComputeDerived(), 0);
+    JSBSim::FGLocation l3;
+    l3 = l;
+    TS_ASSERT_EQUALS(l3.GetGeodAltitude(), alt);
+    TS_ASSERT_EQUALS(l3.GetNumComputeDerived(), 0);
+
+    // A different ellipse invalidates the derived values.
+    l2.SetEllipse(a, a);
+    TS_ASSERT_DIFFERS(l2.GetGeodAltitude(), alt);
+    TS_ASSERT_EQUALS(l2.GetNumComputeDerived(), 1);
+    TS_ASSERT_EQUALS(l.GetNumComputeDerived(), count+1);
+
+    // Moving the location invalidates the derived values.
+    l(1) += 1.0;
+    l.GetGeodAltitude();
+    TS_ASSERT_EQUALS(l.GetNumComputeDerived(), count+2);
+  }
 };
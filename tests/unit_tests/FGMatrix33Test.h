@@ -1,4 +1,5 @@
 #include <iomanip>
+#include <random>
 #include <cxxtest/TestSuite.h>
 #include <math/FGMatrix33.h>
 #include <math/FGQuaternion.h>
@@ -105,6 +106,64 @@ public:
     TS_ASSERT_EQUALS(mT(3,3), 9.0);
   }
 
+  void testTransposedProduct() {
+    const JSBSim::FGMatrix33 m(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0);
+    const JSBSim::FGColumnVector3 v(1.0, -2.0, 0.5);
+    JSBSim::FGColumnVector3 mTv = m.TransposedProduct(v);
+    TS_ASSERT_EQUALS(mTv(1), -3.5);
+    TS_ASSERT_EQUALS(mTv(2), -4.0);
+    TS_ASSERT_EQUALS(mTv(3), -4.5);
+    TS_ASSERT_EQUALS(mTv, m.Transposed()*v);
+
+    // The results must be exactly the same as the product with the
+    // transposed matrix.
+    const JSBSim::FGMatrix33 r(0.1, -0.7, 1.0/3.0, 2.0/7.0, 0.9, -1E-5,
+                               M_PI, 1.0/9.0, -0.3);
+    const JSBSim::FGColumnVector3 w(1.0/3.0, -M_PI, 1E5/7.0);
+    TS_ASSERT_EQUALS(r.TransposedProduct(w), r.Transposed()*w);
+  }
+
+  // The inlined kernels must give exactly the same results as the reference
+  // formulas for random rotations, matrices and vectors.
+  void testRandomProducts() {
+    std::mt19937 gen(20261018);
+    std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+    std::uniform_real_distribution<double> value(-1000.0, 1000.0);
+
+    for (unsigned int i=0; i<1000; i++) {
+      const JSBSim::FGMatrix33 A = JSBSim::FGQuaternion(angle(gen), angle(gen),
+                                                        angle(gen)).GetT();
+      const JSBSim::FGMatrix33 B(value(gen), value(gen), value(gen),
+                                 value(gen), value(gen), value(gen),
+                                 value(gen), value(gen), value(gen));
+      const JSBSim::FGColumnVector3 v(value(gen), value(gen), value(gen));
+
+      JSBSim::FGColumnVector3 Av = A*v;
+      JSBSim::FGColumnVector3 ATv = A.TransposedProduct(v);
+      JSBSim::FGMatrix33 AB = A*B;
+      for (unsigned int r=1; r<=3; r++) {
+        TS_ASSERT_EQUALS(Av(r), v(1)*A(r,1) + v(2)*A(r,2) + v(3)*A(r,3));
+        TS_ASSERT_EQUALS(ATv(r), v(1)*A(1,r) + v(2)*A(2,r) + v(3)*A(3,r));
+        for (unsigned int c=1; c<=3; c++)
+          TS_ASSERT_EQUALS(AB(r,c), A(r,1)*B(1,c) + A(r,2)*B(2,c)
+                                    + A(r,3)*B(3,c));
+      }
+
+      // Cramer's rule
+      JSBSim::FGMatrix33 Binv = B.Inverse();
+      double rdet = 1.0/B.Determinant();
+      TS_ASSERT_EQUALS(Binv(1,1), rdet*(B(2,2)*B(3,3)-B(2,3)*B(3,2)));
+      TS_ASSERT_EQUALS(Binv(1,2), rdet*(B(3,2)*B(1,3)-B(3,3)*B(1,2)));
+      TS_ASSERT_EQUALS(Binv(1,3), rdet*(B(1,2)*B(2,3)-B(1,3)*B(2,2)));
+      TS_ASSERT_EQUALS(Binv(2,1), rdet*(B(2,3)*B(3,1)-B(2,1)*B(3,3)));
+      TS_ASSERT_EQUALS(Binv(2,2), rdet*(B(3,3)*B(1,1)-B(3,1)*B(1,3)));
+      TS_ASSERT_EQUALS(Binv(2,3), rdet*(B(1,3)*B(2,1)-B(1,1)*B(2,3)));
+      TS_ASSERT_EQUALS(Binv(3,1), rdet*(B(2,1)*B(3,2)-B(2,2)*B(3,1)));
+      TS_ASSERT_EQUALS(Binv(3,2), rdet*(B(3,1)*B(1,2)-B(3,2)*B(1,1)));
+      TS_ASSERT_EQUALS(Binv(3,3), rdet*(B(1,1)*B(2,2)-B(1,2)*B(2,1)));
+    }
+  }
+
   void testOperations() {
     JSBSim::FGMatrix33 m0;
     const JSBSim::FGMatrix33 m(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0);
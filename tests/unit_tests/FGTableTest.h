@@ -1,5 +1,6 @@
 #include <sstream>
 #include <limits>
+#include <cmath>
 
 #include <cxxtest/TestSuite.h>
 #include <math/FGTable.h>
@@ -1160,3 +1161,188 @@ public:
     TS_ASSERT_THROWS(FGTable t_2x2x2(pm, el_table), TableException&);
   }
 };
+
+class FGTableSharedDataTest : public CxxTest::TestSuite
+{
+public:
+  void testSharedData() {
+    auto pm = make_shared<FGPropertyManager>();
+    auto x = pm->GetNode("x", true);
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table>"
+                                  "    <independentVar>x</independentVar>"
+                                  "    <tableData>"
+                                  "      0.0  1.0\n"
+                                  "      1.0  3.0\n"
+                                  "      2.0 -2.0\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    Element* el_table = elm->FindElement("table");
+    FGTable::MemoryUsage before = FGTable::GetMemoryUsage();
+
+    FGTable t1(pm, el_table);
+    FGTable::MemoryUsage usage = FGTable::GetMemoryUsage();
+    TS_ASSERT_EQUALS(usage.buffers, before.buffers+1);
+    TS_ASSERT_EQUALS(usage.tables, before.tables+1);
+    size_t bytes = usage.bytes - before.bytes;
+    TS_ASSERT(bytes >= 6*sizeof(double));
+
+    {
+      // Tables with the same content and copies share the same data.
+      FGTable t2(pm, el_table);
+      FGTable t3(t1);
+      usage = FGTable::GetMemoryUsage();
+      TS_ASSERT_EQUALS(usage.buffers, before.buffers+1);
+      TS_ASSERT_EQUALS(usage.tables, before.tables+3);
+      TS_ASSERT_EQUALS(usage.bytes, before.bytes+bytes);
+      TS_ASSERT_EQUALS(usage.unsharedBytes, before.unsharedBytes+3*bytes);
+
+      // The lookup hints are specific to each table.
+      x->setDoubleValue(0.5);
+      TS_ASSERT_EQUALS(t1.GetValue(), 2.0);
+      TS_ASSERT_EQUALS(t2.GetValue(1.5), 0.5);
+      TS_ASSERT_EQUALS(t3.GetValue(), 2.0);
+      TS_ASSERT_EQUALS(t2.GetValue(0.5), 2.0);
+    }
+
+    usage = FGTable::GetMemoryUsage();
+    TS_ASSERT_EQUALS(usage.buffers, before.buffers+1);
+    TS_ASSERT_EQUALS(usage.tables, before.tables+1);
+  }
+
+  void testCopyOnWrite() {
+    auto pm = make_shared<FGPropertyManager>();
+    pm->GetNode("x", true);
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table>"
+                                  "    <independentVar>x</independentVar>"
+                                  "    <tableData>"
+                                  "      0.0  1.0\n"
+                                  "      1.0  3.0\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    Element* el_table = elm->FindElement("table");
+
+    // Modifying a table does not modify the tables that share its data.
+    FGTable t1(pm, el_table);
+    FGTable t2(pm, el_table);
+    FGTable t3(t1);
+    std::istringstream data("0.0 5.0 1.0 7.0");
+    t3 << data;
+    TS_ASSERT_EQUALS(t3.GetValue(0.5), 6.0);
+    TS_ASSERT_EQUALS(t1.GetValue(0.5), 2.0);
+    TS_ASSERT_EQUALS(t2.GetValue(0.5), 2.0);
+
+    // Tables that are not read from XML are copied with their data.
+    FGTable t4(2);
+    t4 << 0.0 << 1.0 << 1.0 << 3.0;
+    FGTable t5(t4);
+    std::istringstream data4("0.0 5.0 1.0 3.0");
+    t4 << data4;
+    TS_ASSERT_EQUALS(t4.GetValue(0.0), 5.0);
+    TS_ASSERT_EQUALS(t5.GetValue(0.0), 1.0);
+  }
+
+  void testDifferentData() {
+    auto pm = make_shared<FGPropertyManager>();
+    pm->GetNode("x", true);
+    Element_ptr elm1 = readFromXML("<dummy>"
+                                   "  <table>"
+                                   "    <independentVar>x</independentVar>"
+                                   "    <tableData>"
+                                   "      0.0  0.0\n"
+                                   "      1.0  3.0\n"
+                                   "    </tableData>"
+                                   "  </table>"
+                                   "</dummy>");
+    // Same values except the sign of zero: the data must not be shared.
+    Element_ptr elm2 = readFromXML("<dummy>"
+                                   "  <table>"
+                                   "    <independentVar>x</independentVar>"
+                                   "    <tableData>"
+                                   "      0.0 -0.0\n"
+                                   "      1.0  3.0\n"
+                                   "    </tableData>"
+                                   "  </table>"
+                                   "</dummy>");
+    FGTable::MemoryUsage before = FGTable::GetMemoryUsage();
+    FGTable t1(pm, elm1->FindElement("table"));
+    FGTable t2(pm, elm2->FindElement("table"));
+    FGTable::MemoryUsage usage = FGTable::GetMemoryUsage();
+    TS_ASSERT_EQUALS(usage.buffers, before.buffers+2);
+    TS_ASSERT(!std::signbit(t1.GetValue(-1.0)));
+    TS_ASSERT(std::signbit(t2.GetValue(-1.0)));
+  }
+};
+
+class FGTableNumericDataTest : public CxxTest::TestSuite
+{
+public:
+  void testNumericData() {
+    auto pm = make_shared<FGPropertyManager>();
+    pm->GetNode("x", true);
+    pm->GetNode("y", true);
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table>"
+                                  "    <independentVar lookup=\"row\">x</independentVar>"
+                                  "    <independentVar lookup=\"column\">y</independentVar>"
+                                  "    <tableData>\n"
+                                  "           0.0   1e1\n"
+                                  "\n"
+                                  "      1.0  -1.5  +.25\r\n"
+                                  "      2.0  3.0   4.0\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    Element* tableData = elm->FindElement("table")->FindElement("tableData");
+    TS_ASSERT(tableData->HasNumericData());
+    TS_ASSERT_EQUALS(tableData->GetNumDataLines(), 3);
+    TS_ASSERT_EQUALS(tableData->GetNumDataValues(0), 2);
+    TS_ASSERT_EQUALS(tableData->GetNumDataValues(1), 3);
+    TS_ASSERT_EQUALS(tableData->GetNumDataValues(3), 0);
+    TS_ASSERT_EQUALS(tableData->GetNumericData().size(), 8);
+    TS_ASSERT_EQUALS(tableData->GetDataLine(1), "1 -1.5 0.25");
+
+    FGTable t(pm, elm->FindElement("table"));
+    TS_ASSERT_EQUALS(t.GetNumRows(), 2);
+    TS_ASSERT_EQUALS(t(0,1), 0.0);
+    TS_ASSERT_EQUALS(t(0,2), 10.0);
+    TS_ASSERT_EQUALS(t(1,0), 1.0);
+    TS_ASSERT_EQUALS(t(1,1), -1.5);
+    TS_ASSERT_EQUALS(t(1,2), 0.25);
+    TS_ASSERT_EQUALS(t(2,2), 4.0);
+
+    // The numeric data is kept by the copies of the element.
+    Element_ptr copy = tableData->Clone();
+    TS_ASSERT(copy->HasNumericData());
+    TS_ASSERT_EQUALS(copy->GetDataLine(2), "2 3 4");
+  }
+
+  void testTextData() {
+    auto pm = make_shared<FGPropertyManager>();
+    pm->GetNode("x", true);
+    // Tokens that are not numbers are stored as text and reported by FGTable.
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table>"
+                                  "    <independentVar>x</independentVar>"
+                                  "    <tableData>"
+                                  "      0.0  1.0\n"
+                                  "      1.0  3.0a\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    Element* tableData = elm->FindElement("table")->FindElement("tableData");
+    TS_ASSERT(!tableData->HasNumericData());
+    TS_ASSERT_EQUALS(tableData->GetNumDataLines(), 2);
+    TS_ASSERT_EQUALS(tableData->GetDataLine(1), "1.0  3.0a");
+    TS_ASSERT_THROWS(FGTable t(pm, elm->FindElement("table")),
+                     TableException&);
+
+    // Other elements are always stored as text.
+    elm = readFromXML("<dummy> 1.0 2.0 </dummy>");
+    TS_ASSERT(!elm->HasNumericData());
+    TS_ASSERT_EQUALS(elm->GetDataLine(), "1.0 2.0");
+  }
+};
@@ -0,0 +1,391 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+#include <FGFDMExec.h>
+#include <math/FGLocation.h>
+#include <input_output/FGTerrainGroundCallback.h>
+#include <initialization/FGInitialCondition.h>
+#include <models/FGGroundReactions.h>
+#include <models/FGInertial.h>
+#include "TestAssertions.h"
+
+const double epsilon = 100. * std::numeric_limits<double>::epsilon();
+const double a = 20925646.32546; // WGS84 semimajor axis length in feet
+const double b = 20855486.5951;  // WGS84 semiminor axis length in feet
+const double fttom = 0.3048;
+const double deg = M_PI/180.;
+
+using namespace JSBSim;
+
+// Writes a binary elevation grid whose elevation (in meters) is a linear
+// function of the latitude and longitude (in degrees):
+// h = h0 + slat*(lat-lat0) + slon*(lon-lon0)
+static void WriteGrid(const std::string& name, double west, double north,
+                      double dlon, double dlat, uint32_t ncols, uint32_t nrows,
+                      double h0, double slat, double slon)
+{
+  std::ofstream f(name, std::ios::binary);
+  auto write32 = [&f](uint32_t v) {
+    for (int i=0; i<4; i++) f.put(char((v >> (8*i)) & 0xff));
+  };
+  auto writeDouble = [&](double v) {
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(v));
+    write32(uint32_t(bits));
+    write32(uint32_t(bits >> 32));
+  };
+
+  f.write("JSBDEM01", 8);
+  write32(ncols);
+  write32(nrows);
+  writeDouble(west);
+  writeDouble(north);
+  writeDouble(dlon);
+  writeDouble(dlat);
+
+  for (uint32_t row=0; row<nrows; row++) {
+    for (uint32_t col=0; col<ncols; col++) {
+      float h = h0 + slat*(north-row*dlat) + slon*(west+col*dlon);
+      uint32_t bits;
+      memcpy(&bits, &h, sizeof(h));
+      write32(bits);
+    }
+  }
+}
+
+// Writes a binary elevation grid of 201x201 points spaced by 1E-5 degree
+// centered on (lat0, lon0) with a cliff: the elevation is 0 west of lon0 and
+// h east of lon0.
+static void WriteCliff(const std::string& name, double lat0, double lon0,
+                       double h)
+{
+  const double d = 1E-5;
+  WriteGrid(name, lon0 - 100.*d, lat0 + 100.*d, d, d, 201, 201, 0.0, 0.0,
+            0.0);
+
+  // Overwrite the elevations of the east half of the grid.
+  std::fstream f(name, std::ios::binary | std::ios::in | std::ios::out);
+  float hf = h;
+  uint32_t bits;
+  memcpy(&bits, &hf, sizeof(hf));
+  for (uint32_t row=0; row<201; row++) {
+    f.seekp(48 + 4*(row*201 + 100));
+    for (uint32_t col=100; col<201; col++)
+      for (int i=0; i<4; i++) f.put(char((bits >> (8*i)) & 0xff));
+  }
+}
+
+// Writes an aircraft with 4 contacts 20 ft ahead, behind, left and right of
+// the CG.
+static void WriteAircraft(const std::string& name)
+{
+  std::ofstream f(name);
+  f << "<?xml version=\"1.0\"?>\n"
+    << "<fdm_config name=\"gear\" version=\"2.0\" release=\"BETA\">\n"
+    << "  <metrics>\n"
+    << "    <wingarea unit=\"FT2\"> 1 </wingarea>\n"
+    << "    <wingspan unit=\"FT\"> 1 </wingspan>\n"
+    << "    <chord unit=\"FT\"> 1 </chord>\n"
+    << "  </metrics>\n"
+    << "  <mass_balance>\n"
+    << "    <ixx unit=\"SLUG*FT2\"> 1000 </ixx>\n"
+    << "    <iyy unit=\"SLUG*FT2\"> 1000 </iyy>\n"
+    << "    <izz unit=\"SLUG*FT2\"> 1000 </izz>\n"
+    << "    <emptywt unit=\"LBS\"> 1000 </emptywt>\n"
+    << "    <location name=\"CG\" unit=\"FT\">\n"
+    << "      <x> 0 </x> <y> 0 </y> <z> 0 </z>\n"
+    << "    </location>\n"
+    << "  </mass_balance>\n"
+    << "  <ground_reactions>\n";
+  const double contacts[4][2] = {{-20., 0.}, {20., 0.}, {0., -20.},
+                                 {0., 20.}};
+  for (auto& xy: contacts) {
+    f << "    <contact type=\"BOGEY\">\n"
+      << "      <location unit=\"FT\">\n"
+      << "        <x> " << xy[0] << " </x> <y> " << xy[1] << " </y> <z> 0 </z>\n"
+      << "      </location>\n"
+      << "      <static_friction> 0.8 </static_friction>\n"
+      << "      <dynamic_friction> 0.5 </dynamic_friction>\n"
+      << "      <spring_coeff unit=\"LBS/FT\"> 10000 </spring_coeff>\n"
+      << "      <damping_coeff unit=\"LBS/FT/SEC\"> 2000 </damping_coeff>\n"
+      << "    </contact>\n";
+  }
+  f << "  </ground_reactions>\n"
+    << "  <propulsion/>\n"
+    << "  <flight_control name=\"FCS\"/>\n"
+    << "  <aerodynamics/>\n"
+    << "</fdm_config>\n";
+}
+
+// Writes a SRTM tile with a constant elevation and an optional void in its
+// north west corner.
+static void WriteSRTM(const std::string& name, unsigned int n, short h,
+                      bool nwVoid=false)
+{
+  std::ofstream f(name, std::ios::binary);
+  for (unsigned int i=0; i<n*n; i++) {
+    short v = (nwVoid && i == 0) ? -32768 : h;
+    f.put(char((v >> 8) & 0xff));
+    f.put(char(v & 0xff));
+  }
+}
+
+class FGTerrainGroundCallbackTest : public CxxTest::TestSuite
+{
+public:
+  void tearDown() {
+    std::remove("terrain_test.dem");
+    std::remove("terrain_test_gear.xml");
+    std::remove("N45W122.hgt");
+    std::remove("N45W121.hgt");
+  }
+
+  void testGridElevation() {
+    // 10 m per degree of latitude, 20 m per degree of longitude.
+    WriteGrid("terrain_test.dem", -123.0, 46.0, 0.01, 0.01, 201, 201, 500.0,
+              10.0, 20.0);
+    auto terrain = std::make_shared<FGTerrain>(SGPath("terrain_test.dem"));
+    FGTerrainGroundCallback cb(terrain, a, b);
+    FGLocation loc, contact;
+    FGColumnVector3 normal, v, w;
+    FGColumnVector3 zero {0., 0., 0.};
+
+    for (double lat = 44.1; lat <= 45.9; lat += 0.3) {
+      for (double lon = -122.9; lon <= -121.1; lon += 0.3) {
+        double h = (500.0 + 10.0*lat + 20.0*lon) / fttom;
+        loc.SetEllipse(a, b);
+        loc.SetPositionGeodetic(lon*deg, lat*deg, h + 100.0);
+        double agl = cb.GetAGLevel(loc, contact, normal, v, w);
+        TS_ASSERT_DELTA(agl, 100.0, 1E-3);
+        TS_ASSERT_DELTA(contact.GetGeodAltitude(), h, 1E-3);
+        TS_ASSERT_VECTOR_EQUALS(v, zero);
+        TS_ASSERT_VECTOR_EQUALS(w, zero);
+
+        // The normal must be orthogonal to the terrain slope.
+        FGLocation north, east;
+        north.SetEllipse(a, b);
+        east.SetEllipse(a, b);
+        north.SetPositionGeodetic(lon*deg, (lat+0.01)*deg, h + 10.0/fttom*0.01);
+        east.SetPositionGeodetic((lon+0.01)*deg, lat*deg, h + 20.0/fttom*0.01);
+        FGColumnVector3 dn = north - contact;
+        FGColumnVector3 de = east - contact;
+        TS_ASSERT_DELTA(DotProduct(normal, dn)/dn.Magnitude(), 0.0, 1E-4);
+        TS_ASSERT_DELTA(DotProduct(normal, de)/de.Magnitude(), 0.0, 1E-4);
+        TS_ASSERT_DELTA(normal.Magnitude(), 1.0, 1E-12);
+      }
+    }
+  }
+
+  void testOutsideCoverage() {
+    WriteGrid("terrain_test.dem", -123.0, 46.0, 0.1, 0.1, 21, 21, 500.0,
+              0.0, 0.0);
+    auto terrain = std::make_shared<FGTerrain>(SGPath("terrain_test.dem"));
+    FGTerrainGroundCallback cb(terrain, a, b);
+    FGLocation loc, contact;
+    FGColumnVector3 normal, v, w;
+
+    cb.SetTerrainElevation(42.0);
+    loc.SetEllipse(a, b);
+    loc.SetPositionGeodetic(10.*deg, 10.*deg, 1000.0);
+    TS_ASSERT_DELTA(cb.GetAGLevel(loc, contact, normal, v, w), 958.0, 1E-6);
+    TS_ASSERT_DELTA(normal(1), cos(10.*deg)*cos(10.*deg), 1E-12);
+    TS_ASSERT_DELTA(normal(2), cos(10.*deg)*sin(10.*deg), 1E-12);
+    TS_ASSERT_DELTA(normal(3), sin(10.*deg), 1E-12);
+
+    // Back on the grid.
+    loc.SetPositionGeodetic(-122.5*deg, 45.5*deg, 2000.0);
+    TS_ASSERT_DELTA(cb.GetAGLevel(loc, contact, normal, v, w),
+                    2000.0 - 500.0/fttom, 1E-3);
+  }
+
+  void testMaxElevation() {
+    // 30 m high cliff at 122 degrees west.
+    WriteCliff("terrain_test.dem", 45.0, -122.0, 30.0);
+    auto terrain = std::make_shared<FGTerrain>(SGPath("terrain_test.dem"));
+    FGTerrainGroundCallback cb(terrain, a, b);
+    FGLocation center, loc, contact;
+    FGColumnVector3 normal, v, w;
+    double hmax;
+    center.SetEllipse(a, b);
+
+    // The bound must be above the elevation of all the points of the disc,
+    // on both sides of the cliff and over it.
+    for (double lon = -122.0005; lon <= -121.9995; lon += 1E-4) {
+      for (double radius: {5.0, 30.0, 60.0}) {
+        center.SetPositionGeodetic(lon*deg, 45.0*deg, 1000.0);
+        TS_ASSERT(cb.GetMaxTerrainElevation(center, radius, hmax));
+        double hdisc = -HUGE_VAL;
+        for (double r = 0.0; r <= radius; r += 0.25*radius) {
+          for (double angle = 0.0; angle < 360.0; angle += 10.0) {
+            FGColumnVector3 local(r*cos(angle*deg), r*sin(angle*deg), 0.0);
+            loc = center.LocalToLocation(local);
+            loc.SetEllipse(a, b);
+            double h = loc.GetGeodAltitude()
+                     - cb.GetAGLevel(loc, contact, normal, v, w);
+            hdisc = std::max(hdisc, h);
+          }
+        }
+        TS_ASSERT_LESS_THAN_EQUALS(hdisc, hmax + 1E-6);
+      }
+    }
+
+    // The bound is tight on the sides of the cliff.
+    center.SetPositionGeodetic(-122.0004*deg, 45.0*deg, 1000.0);
+    TS_ASSERT(cb.GetMaxTerrainElevation(center, 30.0, hmax));
+    TS_ASSERT_DELTA(hmax, 0.0, 1E-9);
+    center.SetPositionGeodetic(-122.00004*deg, 45.0*deg, 1000.0);
+    TS_ASSERT(cb.GetMaxTerrainElevation(center, 30.0, hmax));
+    TS_ASSERT_DELTA(hmax, 30.0/fttom, 1E-3);
+
+    // Outside of the grid, the elevation is the default terrain elevation.
+    cb.SetTerrainElevation(42.0);
+    center.SetPositionGeodetic(-121.0*deg, 45.0*deg, 1000.0);
+    TS_ASSERT(cb.GetMaxTerrainElevation(center, 30.0, hmax));
+    TS_ASSERT_DELTA(hmax, 42.0, 1E-9);
+    // On the edge of the grid.
+    center.SetPositionGeodetic(-121.999*deg, 45.0*deg, 1000.0);
+    TS_ASSERT(cb.GetMaxTerrainElevation(center, 30.0, hmax));
+    TS_ASSERT_DELTA(hmax, 30.0/fttom, 1E-3);
+    cb.SetTerrainElevation(200.0);
+    TS_ASSERT(cb.GetMaxTerrainElevation(center, 30.0, hmax));
+    TS_ASSERT_DELTA(hmax, 200.0, 1E-9);
+
+    // Areas that are too large can not be bounded.
+    center.SetPositionGeodetic(-122.0*deg, 45.0*deg, 1000.0);
+    TS_ASSERT(!cb.GetMaxTerrainElevation(center, 1E6, hmax));
+  }
+
+  // Check that the ground reactions match the forces computed gear by gear
+  // with the ground callback when the aircraft flies by a cliff.
+  void testGroundReactionsNearCliff() {
+    // 30 m (98.4 ft) high cliff at 122 degrees west.
+    WriteCliff("terrain_test.dem", 45.0, -122.0, 30.0);
+    WriteAircraft("terrain_test_gear.xml");
+    auto terrain = std::make_shared<FGTerrain>(SGPath("terrain_test.dem"));
+
+    // The CG is about 10 ft west of the cliff and the aircraft is heading
+    // east so the front contact is over the cliff.
+    for (double altitude: {60.0, 95.0, 101.0, 130.0, 500.0}) {
+      FGFDMExec fdmex;
+      TS_ASSERT(fdmex.LoadModel(SGPath("."), SGPath("."), SGPath("."),
+                                "terrain_test_gear", false));
+      auto inertial = fdmex.GetInertial();
+      inertial->SetGroundCallback(new FGTerrainGroundCallback(terrain,
+                                                    inertial->GetSemimajor(),
+                                                    inertial->GetSemiminor()));
+      auto ic = fdmex.GetIC();
+      ic->SetGeodLatitudeDegIC(45.0);
+      ic->SetLongitudeDegIC(-122.00004);
+      ic->SetAltitudeASLFtIC(altitude);
+      ic->SetPsiDegIC(90.0);
+      ic->SetVgroundFpsIC(0.0);
+      TS_ASSERT(fdmex.RunIC());
+
+      auto groundReactions = fdmex.GetGroundReactions();
+      FGColumnVector3 forces = groundReactions->GetForces();
+      FGColumnVector3 moments = groundReactions->GetMoments();
+      FGColumnVector3 gearForces, gearMoments;
+      for (int i=0; i<groundReactions->GetNumGearUnits(); i++) {
+        auto gear = groundReactions->GetGearUnit(i);
+        gearForces += gear->GetBodyForces(groundReactions.get());
+        gearMoments += gear->GetMoments();
+      }
+
+      TS_ASSERT_VECTOR_EQUALS(forces, gearForces);
+      TS_ASSERT_VECTOR_EQUALS(moments, gearMoments);
+
+      // The copies of the executive share the terrain.
+      std::unique_ptr<FGFDMExec> clone(fdmex.Clone());
+      TS_ASSERT_VECTOR_EQUALS(clone->GetGroundReactions()->GetForces(),
+                              forces);
+
+      // Only the front contact hits the cliff between 60 ft and 98.4 ft.
+      if (altitude < 30.0/fttom)
+        TS_ASSERT(forces.Magnitude() > 0.0);
+      else
+        TS_ASSERT_EQUALS(forces.Magnitude(), 0.0);
+    }
+  }
+
+  void testInvalidFiles() {
+    std::ofstream("terrain_test.dem") << "not a terrain file";
+    TS_ASSERT_THROWS(FGTerrain(SGPath("terrain_test.dem")), JSBBaseException&);
+    TS_ASSERT_THROWS(FGTerrain(SGPath("no_such_file.dem")), JSBBaseException&);
+  }
+
+  void testSRTMTileCache() {
+    WriteSRTM("N45W122.hgt", 121, 100, true);
+    WriteSRTM("N45W121.hgt", 121, 200);
+    auto terrain = std::make_shared<FGTerrain>(SGPath("."), 1);
+    FGTerrainGroundCallback cb1(terrain, a, b), cb2(terrain, a, b);
+    FGLocation loc, contact;
+    FGColumnVector3 normal, v, w;
+    loc.SetEllipse(a, b);
+
+    loc.SetPositionGeodetic(-121.5*deg, 45.5*deg, 1000.0);
+    TS_ASSERT_DELTA(cb1.GetAGLevel(loc, contact, normal, v, w),
+                    1000.0 - 100.0/fttom, 1E-6);
+    TS_ASSERT_EQUALS(terrain->GetNumTileLoads(), 1);
+
+    // The void is replaced by the neighbouring elevations.
+    loc.SetPositionGeodetic(-122.0*deg, 46.0*deg, 1000.0);
+    TS_ASSERT_DELTA(cb1.GetAGLevel(loc, contact, normal, v, w),
+                    1000.0 - 100.0/fttom, 1E-6);
+
+    // The second tile evicts the first one from the cache.
+    loc.SetPositionGeodetic(-120.5*deg, 45.5*deg, 1000.0);
+    TS_ASSERT_DELTA(cb2.GetAGLevel(loc, contact, normal, v, w),
+                    1000.0 - 200.0/fttom, 1E-6);
+    TS_ASSERT_EQUALS(terrain->GetNumTileLoads(), 2);
+    TS_ASSERT_EQUALS(terrain->GetNumCachedTiles(), 1);
+
+    // The first callback still holds its tile so no reload is needed.
+    loc.SetPositionGeodetic(-121.4*deg, 45.4*deg, 1000.0);
+    TS_ASSERT_DELTA(cb1.GetAGLevel(loc, contact, normal, v, w),
+                    1000.0 - 100.0/fttom, 1E-6);
+    TS_ASSERT_EQUALS(terrain->GetNumTileLoads(), 2);
+
+    // No tile: the terrain elevation is used.
+    loc.SetPositionGeodetic(10.0*deg, 10.0*deg, 1000.0);
+    TS_ASSERT_DELTA(cb2.GetAGLevel(loc, contact, normal, v, w), 1000.0, 1E-6);
+  }
+
+  // Measures the number of lookups per second for 3 gear contacts evaluated
+  // at 120 Hz by 8 aircraft sharing the same terrain.
+  void testSharedTerrain() {
+    WriteGrid("terrain_test.dem", -123.0, 46.0, 1./1200., 1./1200., 1201,
+              1201, 500.0, 10.0, 20.0);
+    auto terrain = std::make_shared<FGTerrain>(SGPath("terrain_test.dem"));
+    std::vector<std::unique_ptr<FGTerrainGroundCallback>> callbacks;
+    for (int i=0; i<8; i++)
+      callbacks.emplace_back(new FGTerrainGroundCallback(terrain, a, b));
+    auto ownTerrain = std::make_shared<FGTerrain>(SGPath("terrain_test.dem"));
+    FGTerrainGroundCallback reference(ownTerrain, a, b);
+
+    // The callbacks that share the terrain return the same results as a
+    // callback with its own terrain and the tile is loaded only once.
+    FGLocation loc, contact, refContact;
+    FGColumnVector3 normal, v, w, refNormal;
+    loc.SetEllipse(a, b);
+    for (int frame=0; frame<100; frame++) {
+      for (unsigned int i=0; i<callbacks.size(); i++) {
+        double lat = 44.5 + 0.1*i + 1E-4*frame;
+        double lon = -122.5 + 2E-4*frame;
+        for (int gear=0; gear<3; gear++) {
+          loc.SetPositionGeodetic(lon*deg, (lat+1E-5*gear)*deg, 1000.0);
+          double agl = callbacks[i]->GetAGLevel(loc, contact, normal, v, w);
+          double refAgl = reference.GetAGLevel(loc, refContact, refNormal, v,
+                                               w);
+          TS_ASSERT_EQUALS(agl, refAgl);
+          TS_ASSERT_VECTOR_EQUALS(normal, refNormal);
+        }
+      }
+    }
+    TS_ASSERT_EQUALS(terrain->GetNumTileLoads(), 1);
+  }
+};
@@ -0,0 +1,345 @@
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+#include <cxxtest/TestSuite.h>
+
+#include <FGJSBBase.h>
+#include <input_output/FGXMLFileRead.h>
+
+using namespace JSBSim;
+
+class FGXMLFileReadTest : public CxxTest::TestSuite
+{
+public:
+  void setUp() {
+    FGXMLFileRead::ClearCache();
+  }
+
+  void tearDown() {
+    FGXMLFileRead::SetCacheCapacity(512);
+    std::remove("xml_cache_test.xml");
+    std::remove("xml_cache_test.jsbimg");
+    for (int i=0; i<8; ++i)
+      std::remove(("xml_preload_test" + std::to_string(i) + ".xml").c_str());
+  }
+
+  void testCache() {
+    std::ofstream("xml_cache_test.xml")
+      << "<?xml version=\"1.0\"?>\n"
+      << "<root name=\"test\">\n  <value> 1.0 </value>\n</root>\n";
+
+    FGXMLFileRead reader1, reader2;
+    Element* doc1 = reader1.LoadXMLDocument(SGPath("xml_cache_test.xml"));
+    TS_ASSERT(doc1 != nullptr);
+    TS_ASSERT_EQUALS(doc1->GetName(), "root");
+    TS_ASSERT_EQUALS(doc1->GetAttributeValue("name"), "test");
+    TS_ASSERT_EQUALS(doc1->FindElementValueAsNumber("value"), 1.0);
+
+    // The second load is served from the cache.
+    Element* doc2 = reader2.LoadXMLDocument(SGPath("xml_cache_test.xml"));
+    TS_ASSERT(doc2 != nullptr);
+    TS_ASSERT(doc2 != doc1);
+    TS_ASSERT_EQUALS(doc2->GetName(), "root");
+    TS_ASSERT_EQUALS(doc2->GetAttributeValue("name"), "test");
+    TS_ASSERT_EQUALS(doc2->FindElementValueAsNumber("value"), 1.0);
+    TS_ASSERT_EQUALS(doc2->FindElement("value")->GetParent(), doc2);
+    TS_ASSERT_EQUALS(doc2->GetLineNumber(), 2);
+
+    FGXMLFileRead::CacheStatistics stats = FGXMLFileRead::GetCacheStatistics();
+    TS_ASSERT_EQUALS(stats.hits, 1);
+    TS_ASSERT_EQUALS(stats.misses, 1);
+    TS_ASSERT_EQUALS(stats.documents, 1);
+
+    // Modifying a loaded document does not modify the cached document.
+    doc2->SetAttributeValue("name", "modified");
+    FGXMLFileRead reader3;
+    Element* doc3 = reader3.LoadXMLDocument(SGPath("xml_cache_test.xml"));
+    TS_ASSERT_EQUALS(doc3->GetAttributeValue("name"), "test");
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().hits, 2);
+  }
+
+  void testModifiedFile() {
+    std::ofstream("xml_cache_test.xml")
+      << "<?xml version=\"1.0\"?>\n<root> 1.0 </root>\n";
+    FGXMLFileRead reader1;
+    Element* doc = reader1.LoadXMLDocument(SGPath("xml_cache_test.xml"));
+    TS_ASSERT_EQUALS(doc->GetDataAsNumber(), 1.0);
+
+    // Same size, different content: the file is parsed again.
+    std::ofstream("xml_cache_test.xml")
+      << "<?xml version=\"1.0\"?>\n<root> 2.0 </root>\n";
+    FGXMLFileRead reader2;
+    doc = reader2.LoadXMLDocument(SGPath("xml_cache_test.xml"));
+    TS_ASSERT_EQUALS(doc->GetDataAsNumber(), 2.0);
+
+    FGXMLFileRead::CacheStatistics stats = FGXMLFileRead::GetCacheStatistics();
+    TS_ASSERT_EQUALS(stats.hits, 0);
+    TS_ASSERT_EQUALS(stats.misses, 2);
+    TS_ASSERT_EQUALS(stats.documents, 1);
+  }
+
+  void testUnchangedFile() {
+    // Date the file back so that its modification time can be trusted.
+    std::ofstream("xml_cache_test.xml")
+      << "<?xml version=\"1.0\"?>\n<root> 1.0 </root>\n";
+    utimbuf stamp;
+    stamp.actime = stamp.modtime = time(nullptr) - 10;
+    TS_ASSERT_EQUALS(utime("xml_cache_test.xml", &stamp), 0);
+    FGXMLFileRead reader1;
+    Element* doc = reader1.LoadXMLDocument(SGPath("xml_cache_test.xml"));
+    TS_ASSERT_EQUALS(doc->GetDataAsNumber(), 1.0);
+
+    // The content is modified but the size and the modification time are
+    // restored: the file is not read again and the cached document is used.
+    std::ofstream("xml_cache_test.xml")
+      << "<?xml version=\"1.0\"?>\n<root> 2.0 </root>\n";
+    TS_ASSERT_EQUALS(utime("xml_cache_test.xml", &stamp), 0);
+    FGXMLFileRead reader2;
+    doc = reader2.LoadXMLDocument(SGPath("xml_cache_test.xml"));
+    TS_ASSERT_EQUALS(doc->GetDataAsNumber(), 1.0);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().hits, 1);
+
+    // A new modification time triggers a new read.
+    stamp.actime = stamp.modtime += 1;
+    TS_ASSERT_EQUALS(utime("xml_cache_test.xml", &stamp), 0);
+    FGXMLFileRead reader3;
+    doc = reader3.LoadXMLDocument(SGPath("xml_cache_test.xml"));
+    TS_ASSERT_EQUALS(doc->GetDataAsNumber(), 2.0);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().misses, 2);
+  }
+
+  void testCapacity() {
+    FGXMLFileRead::SetCacheCapacity(2);
+    for (int i=0; i<3; ++i) {
+      std::string name = "xml_preload_test" + std::to_string(i) + ".xml";
+      std::ofstream(name) << "<?xml version=\"1.0\"?>\n<root/>\n";
+      FGXMLFileRead reader;
+      TS_ASSERT(reader.LoadXMLDocument(SGPath(name)) != nullptr);
+    }
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().documents, 2);
+
+    // The least recently used document has been evicted.
+    FGXMLFileRead reader0, reader2;
+    reader2.LoadXMLDocument(SGPath("xml_preload_test2.xml"));
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().hits, 1);
+    reader0.LoadXMLDocument(SGPath("xml_preload_test0.xml"));
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().misses, 4);
+
+    // A null capacity disables the cache.
+    FGXMLFileRead::SetCacheCapacity(0);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().documents, 0);
+    FGXMLFileRead reader3;
+    TS_ASSERT(reader3.LoadXMLDocument(SGPath("xml_preload_test1.xml")) != nullptr);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().documents, 0);
+  }
+
+  void testImage() {
+    std::ofstream("xml_cache_test.xml")
+      << "<?xml version=\"1.0\"?>\n"
+      << "<root name=\"test\">\n  <value unit=\"FT\"> 1.0 </value>\n"
+      << "  <table>\n    1 2\n    3 4\n  </table>\n"
+      << "  <tableData>\n    1 2\n    3 -4.5\n  </tableData>\n</root>\n";
+    FGXMLFileRead reader1;
+    TS_ASSERT(reader1.LoadXMLDocument(SGPath("xml_cache_test.xml")) != nullptr);
+    TS_ASSERT(FGXMLFileRead::WriteImage(SGPath("xml_cache_test.jsbimg"),
+                                        {SGPath("xml_cache_test.xml")},
+                                        SGPath(".")));
+
+    FGXMLFileRead::ClearCache();
+    TS_ASSERT(FGXMLFileRead::ReadImage(SGPath("xml_cache_test.jsbimg"),
+                                       SGPath(".")));
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().documents, 1);
+
+    // The document is served from the image.
+    FGXMLFileRead reader2;
+    Element* doc = reader2.LoadXMLDocument(SGPath("xml_cache_test.xml"));
+    TS_ASSERT(doc != nullptr);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().hits, 1);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().misses, 0);
+    TS_ASSERT_EQUALS(doc->GetAttributeValue("name"), "test");
+    TS_ASSERT_EQUALS(doc->GetLineNumber(), 2);
+    Element* value = doc->FindElement("value");
+    TS_ASSERT_EQUALS(value->GetParent(), doc);
+    TS_ASSERT_EQUALS(value->GetAttributeValue("unit"), "FT");
+    TS_ASSERT_EQUALS(value->GetDataAsNumber(), 1.0);
+    Element* table = doc->FindElement("table");
+    TS_ASSERT_EQUALS(table->GetNumDataLines(), 2);
+    TS_ASSERT_EQUALS(table->GetDataLine(1), "3 4");
+    Element* tableData = doc->FindElement("tableData");
+    TS_ASSERT(tableData->HasNumericData());
+    TS_ASSERT_EQUALS(tableData->GetNumDataLines(), 2);
+    TS_ASSERT_EQUALS(tableData->GetNumericData().back(), -4.5);
+
+    // A stale image entry is ignored and the XML file is parsed.
+    std::ofstream("xml_cache_test.xml")
+      << "<?xml version=\"1.0\"?>\n<root name=\"new\"/>\n";
+    FGXMLFileRead::ClearCache();
+    TS_ASSERT(FGXMLFileRead::ReadImage(SGPath("xml_cache_test.jsbimg"),
+                                       SGPath(".")));
+    FGXMLFileRead reader3;
+    doc = reader3.LoadXMLDocument(SGPath("xml_cache_test.xml"));
+    TS_ASSERT_EQUALS(doc->GetAttributeValue("name"), "new");
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().misses, 1);
+
+    // Invalid images are rejected.
+    std::ofstream("xml_cache_test.jsbimg") << "garbage";
+    FGXMLFileRead::ClearCache();
+    TS_ASSERT(!FGXMLFileRead::ReadImage(SGPath("xml_cache_test.jsbimg"),
+                                       SGPath(".")));
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().documents, 0);
+  }
+
+  void testImageFiles() {
+    for (int i=0; i<2; ++i) {
+      std::string name = "xml_preload_test" + std::to_string(i) + ".xml";
+      std::ofstream(name) << "<?xml version=\"1.0\"?>\n<root> " << i
+                          << " </root>\n";
+      FGXMLFileRead reader;
+      TS_ASSERT(reader.LoadXMLDocument(SGPath(name)) != nullptr);
+    }
+
+    // Only the requested files are written and their paths are relative to
+    // the root directory.
+    TS_ASSERT(FGXMLFileRead::WriteImage(SGPath("xml_cache_test.jsbimg"),
+                                        {SGPath("xml_preload_test1")},
+                                        SGPath(".")));
+    std::ifstream file("xml_cache_test.jsbimg", std::ios::binary);
+    std::string image((std::istreambuf_iterator<char>(file)),
+                      std::istreambuf_iterator<char>());
+    TS_ASSERT_EQUALS(image.find("xml_preload_test0"), std::string::npos);
+    TS_ASSERT_DIFFERS(image.find("xml_preload_test1"), std::string::npos);
+    TS_ASSERT_EQUALS(image.find(SGPath(".").realpath().utf8Str()),
+                     std::string::npos);
+
+    FGXMLFileRead::ClearCache();
+    TS_ASSERT(FGXMLFileRead::ReadImage(SGPath("xml_cache_test.jsbimg"),
+                                       SGPath(".")));
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().documents, 1);
+    FGXMLFileRead reader;
+    Element* doc = reader.LoadXMLDocument(SGPath("xml_preload_test1.xml"));
+    TS_ASSERT_EQUALS(doc->GetDataAsNumber(), 1.0);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().hits, 1);
+  }
+
+  void testCorruptedImage() {
+    std::ofstream("xml_cache_test.xml")
+      << "<?xml version=\"1.0\"?>\n"
+      << "<root name=\"test\">\n  <value unit=\"FT\"> 1.0 </value>\n"
+      << "  <tableData>\n    1 2\n    3 -4.5\n  </tableData>\n</root>\n";
+    FGXMLFileRead reader;
+    TS_ASSERT(reader.LoadXMLDocument(SGPath("xml_cache_test.xml")) != nullptr);
+    TS_ASSERT(FGXMLFileRead::WriteImage(SGPath("xml_cache_test.jsbimg"),
+                                        {SGPath("xml_cache_test.xml")},
+                                        SGPath(".")));
+    std::ifstream file("xml_cache_test.jsbimg", std::ios::binary);
+    std::string image((std::istreambuf_iterator<char>(file)),
+                      std::istreambuf_iterator<char>());
+    file.close();
+
+    auto ReadModified = [](const std::string& content) {
+      std::ofstream("xml_cache_test.jsbimg", std::ios::binary) << content;
+      FGXMLFileRead::ClearCache();
+      return FGXMLFileRead::ReadImage(SGPath("xml_cache_test.jsbimg"),
+                                      SGPath("."));
+    };
+
+    // Truncated images are rejected.
+    for (size_t size=0; size<image.size(); ++size) {
+      TS_ASSERT(!ReadModified(image.substr(0, size)));
+      TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().documents, 0);
+    }
+
+    // Huge sizes or counts are rejected before being allocated.
+    for (size_t pos=12; pos+4<=image.size(); ++pos) {
+      std::string corrupted = image;
+      corrupted.replace(pos, 4, "\xff\xff\xff\x7f");
+      ReadModified(corrupted);
+    }
+
+    TS_ASSERT(ReadModified(image));
+  }
+
+  void testPreload() {
+    std::vector<SGPath> files;
+    for (int i=0; i<4; ++i) {
+      std::string name = "xml_preload_test" + std::to_string(i) + ".xml";
+      std::ofstream(name) << "<?xml version=\"1.0\"?>\n<root> " << i
+                          << " </root>\n";
+      files.push_back(SGPath(name));
+    }
+    // Duplicates and missing files are ignored.
+    files.push_back(SGPath("xml_preload_test0.xml"));
+    files.push_back(SGPath("no_such_file.xml"));
+
+    FGXMLFileRead::Preload(files, 3);
+    FGXMLFileRead::CacheStatistics stats = FGXMLFileRead::GetCacheStatistics();
+    TS_ASSERT_EQUALS(stats.misses, 4);
+    TS_ASSERT_EQUALS(stats.hits, 0);
+    TS_ASSERT_EQUALS(stats.documents, 4);
+
+    // The files already cached are not parsed again.
+    FGXMLFileRead::Preload(files, 3);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().misses, 4);
+
+    for (int i=0; i<4; ++i) {
+      FGXMLFileRead reader;
+      Element* doc = reader.LoadXMLDocument(files[i]);
+      TS_ASSERT(doc != nullptr);
+      TS_ASSERT_EQUALS(doc->GetDataAsNumber(), i);
+    }
+    // The preloaded files are not read a second time.
+    stats = FGXMLFileRead::GetCacheStatistics();
+    TS_ASSERT_EQUALS(stats.hits, 4);
+    TS_ASSERT_EQUALS(stats.misses, 4);
+    TS_ASSERT_EQUALS(stats.reads, 8);
+
+    // The files modified within the last second are checked again.
+    FGXMLFileRead reader;
+    TS_ASSERT(reader.LoadXMLDocument(files[0]) != nullptr);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().reads, 9);
+  }
+
+  void testPreloadMalformedFiles() {
+    // Half of the files are malformed: the parsing errors are thrown in the
+    // worker threads as well as in the calling thread.
+    std::vector<SGPath> files;
+    for (int i=0; i<8; ++i) {
+      std::string name = "xml_preload_test" + std::to_string(i) + ".xml";
+      if (i % 2)
+        std::ofstream(name) << "<?xml version=\"1.0\"?>\n<root> " << i
+                            << " </wrong>\n";
+      else
+        std::ofstream(name) << "<?xml version=\"1.0\"?>\n<root> " << i
+                            << " </root>\n";
+      files.push_back(SGPath(name));
+    }
+
+    FGXMLFileRead::Preload(files, 4);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().documents, 4);
+
+    // The errors are reported when the malformed files are loaded.
+    for (int i=0; i<8; ++i) {
+      FGXMLFileRead reader;
+      if (i % 2)
+        TS_ASSERT_THROWS(reader.LoadXMLDocument(files[i]),
+                         JSBBaseException&);
+      else
+        TS_ASSERT_EQUALS(reader.LoadXMLDocument(files[i])->GetDataAsNumber(),
+                         i);
+    }
+  }
+
+  void testMissingFile() {
+    FGXMLFileRead reader;
+    TS_ASSERT(reader.LoadXMLDocument(SGPath("no_such_file.xml"), false) == nullptr);
+    TS_ASSERT_EQUALS(FGXMLFileRead::GetCacheStatistics().misses, 0);
+  }
+};